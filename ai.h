@@ -2,38 +2,113 @@
 #define AI_H
 
 #include "player.h"
+#include "density_map.h"
+#include "endgame_solver.h"
+#include "opening_book.h"
+#include "placement_library.h"
+#include "opponent_model.h"
+#include "target_pool.h"
+#include "thread_pool.h"
+#include <array>
+#include <chrono>
+#include <memory>
 #include <random>
 #include <vector>
 #include <queue>
 
 // Базовий клас для AI гравців
 class AIPlayer : public Player {
+public:
+    // Кількість ще не потоплених кораблів кожного розміру
+    typedef DensityMap::ShipCounts ShipCounts;
+    
 protected:
     std::mt19937 rng;
     
+    // Книга дебютів, спільна для всіх AI (може бути порожньою)
+    std::shared_ptr<const OpeningBook> openingBook;
+    
+    // Бібліотека розстановок для власного флоту (може бути порожньою)
+    std::shared_ptr<const PlacementLibrary> placementLibrary;
+    
+    // Множники клітинок з моделі поточного суперника
+    OpponentModel::Prior opponentPrior;
+    bool hasOpponentPrior;
+    
+    // Точний розв'язувач для кінця гри
+    EndgameSolver endgame;
+    
+    // Час на хід і темп для chooseTarget() без аргументів
+    std::chrono::microseconds moveTime;
+    Pace movePace;
+    
+    void remainingShips(ShipCounts& counts) const;
+    
+    // Постріл з книги дебютів для поточної позиції
+    bool chooseBookTarget(Coordinate& target) const;
+    
+    // Постріл від розв'язувача, якщо сумісних розстановок не більше порогу
+    bool chooseEndgameTarget(Coordinate& target);
+    
+    // Пауза "на роздуми" в інтерактивному темпі, не довша за дедлайн
+    static void thinkingPause(MoveClock::time_point deadline, Pace pace, std::chrono::milliseconds pause);
+    
 public:
     AIPlayer(const std::string& aiName = "AI");
     virtual ~AIPlayer() = default;
     
+    // Відтворюваний потік випадкових чисел (симуляції, тести)
+    void setSeed(std::mt19937::result_type seed) { rng.seed(seed); }
+    
+    void setOpeningBook(std::shared_ptr<const OpeningBook> book) { openingBook = book; }
+    void setPlacementLibrary(std::shared_ptr<const PlacementLibrary> library) { placementLibrary = library; }
+    
+    // Теплова карта кораблів суперника з попередніх ігор (пріор для вибору цілі)
+    void setOpponent(const OpponentModel& model, const std::string& opponent) {
+        hasOpponentPrior = model.prior(opponent, opponentPrior);
+    }
+    
+    // Найбільша кількість сумісних розстановок, за якої AI переходить
+    // на точний розв'язувач (0 - не переходити, за замовчуванням;
+    // EndgameSolver::RECOMMENDED_MAX_LAYOUTS - для гри з людиною)
+    void setEndgameThreshold(int maxLayouts) { endgame.setMaxLayouts(maxLayouts); }
+    int getEndgameThreshold() const { return endgame.getMaxLayouts(); }
+    
+    // Пошукові AI витрачають на хід увесь цей час, прості відповідають одразу
+    void setMoveTime(std::chrono::microseconds time) { moveTime = time; }
+    std::chrono::microseconds getMoveTime() const { return moveTime; }
+    
+    // Pace::HEADLESS - без жодних затримок
+    void setPace(Pace pace) { movePace = pace; }
+    Pace getPace() const { return movePace; }
+    
     // Автоматичне розміщення кораблів
     void placeShips() override;
     
-    // Вибір цілі - чисто віртуальний метод
-    virtual Coordinate chooseTarget() override = 0;
+    // AI (і плагін) може помилятись без кінця - на нього діє ліміт неправильних пострілів
+    bool isInteractive() const override { return false; }
+    
+    // Хід з дедлайном через getMoveTime() від поточного моменту
+    Coordinate chooseTarget() override final;
+    
+    // Вибір цілі до deadline - чисто віртуальний метод
+    Coordinate chooseTarget(MoveClock::time_point deadline, Pace pace) override = 0;
 };
 
 // AI з випадковими пострілами
 class RandomAI : public AIPlayer {
 private:
-    std::vector<Coordinate> availableTargets;
+    TargetPool availableTargets;  // Ще не обстріляні клітинки
     
     void initializeTargets();
-    void removeTarget(const Coordinate& coord);
     
 public:
     RandomAI(const std::string& aiName = "Random AI");
     
-    Coordinate chooseTarget() override;
+    void reset() override;
+    
+    using AIPlayer::chooseTarget;
+    Coordinate chooseTarget(MoveClock::time_point deadline, Pace pace) override;
 };
 
 // Розумний AI з стратегією
@@ -49,20 +124,128 @@ private:
     Coordinate lastHit;                   // Останнє влучання
     std::vector<Coordinate> currentShipHits; // Влучання по поточному кораблю
     
+    // Ще не обстріляні клітинки для режиму пошуку за парністю (row + col) % 2.
+    // Обстріляна клітинка прибирається після кожного пострілу
+    Board::Mask huntCells[2];
+    
+    // Пошук за густиною замість випадкової клітинки потрібної парності
+    bool densityHunt;
+    
     // Допоміжні методи
     std::vector<Coordinate> getAdjacentCells(const Coordinate& coord) const;
     void addAdjacentTargets(const Coordinate& coord);
     Coordinate getSmartHuntTarget();
+    
+    // Кандидат, через який проходить найбільше можливих позицій кораблів
+    // (густина від SIMD-ядра DensityKernel); -1, якщо ядро не підходить.
+    // Використовується лише при setDensityHunt(true)
+    int densestHuntCell(const Board::Mask& candidates);
     bool isValidTarget(const Coordinate& coord) const;
     void analyzeShipDirection();
     
 public:
     SmartAI(const std::string& aiName = "Smart AI");
     
-    Coordinate chooseTarget() override;
+    void reset() override;
+    
+    // За замовчуванням пошук вибирає випадкову клітинку за O(1). Пошук за
+    // густиною точніший (менше пострілів), але рахує всі позиції кожен хід
+    void setDensityHunt(bool enabled) { densityHunt = enabled; }
+    bool getDensityHunt() const { return densityHunt; }
+    
+    using AIPlayer::chooseTarget;
+    Coordinate chooseTarget(MoveClock::time_point deadline, Pace pace) override;
     
     // Оновлення стану AI після пострілу
     void updateAfterShot(const Coordinate& coord, ShotResult result);
+    
+    // Оновлює стан добивання, записує постріл у trackingBoard
+    // і прибирає клітинки для пошуку
+    void processShotResult(const Coordinate& coord, ShotResult result) override;
+};
+
+// AI, який стріляє в клітинку з найбільшою кількістю можливих позицій
+// ще не потоплених кораблів (густина ймовірності)
+class DensityAI : public AIPlayer {
+public:
+    // Зважена кількість позицій кораблів, що проходять через кожну клітинку
+    typedef DensityMap::Density Density;
+    
+private:
+    // Густина, яка оновлюється після кожного пострілу (єдине джерело густини;
+    // повністю перебудовується лише якщо trackingBoard змінили в обхід
+    // processShotResult)
+    DensityMap densityMap;
+    
+public:
+    DensityAI(const std::string& aiName = "Density AI");
+    
+    void reset() override;
+    
+    // Ціль з найбільшою густиною (без виводу в консоль)
+    Coordinate selectTarget();
+    
+    // Густина рахується за мікросекунди, тож дедлайн не потрібен
+    using AIPlayer::chooseTarget;
+    Coordinate chooseTarget(MoveClock::time_point deadline, Pace pace) override;
+    
+    // Після запису пострілу в trackingBoard оновлює карту густини
+    void processShotResult(const Coordinate& coord, ShotResult result) override;
+};
+
+// AI, який семплює повні розстановки флоту, сумісні з усім побаченим
+// (влучання, промахи, потоплені кораблі, правило сусідства), і стріляє туди,
+// де кораблі опинялись найчастіше. Семплювання йде в пулі потоків до
+// дедлайну ходу
+class MonteCarloAI : public DensityAI {
+public:
+    typedef MoveClock Clock;
+    
+private:
+    // Спостереження, спільне для всіх потоків під час одного ходу
+    struct Observation {
+        Board::Mask blocked;   // Клітинки, де непотоплених кораблів немає
+        Board::Mask openHits;  // Влучання по непотоплених кораблях
+        int sizes[StandardGeometry::FLEET_SIZE];  // Розміри непотоплених кораблів
+        int shipCount;
+    };
+    
+    // Пул потоків (може бути спільним з іншими AI) і кількість завдань
+    // семплювання на хід; при одному завданні пул не потрібен
+    std::shared_ptr<ThreadPool> pool;
+    int parallelism;
+    long long sampleBudget;
+    long long lastSampleCount;
+    
+    // Одна розстановка: клітинки всіх непотоплених кораблів.
+    // false, якщо спроба зайшла в глухий кут
+    static bool sampleLayout(const Observation& observation, std::mt19937& gen,
+                             Board::Mask& shipCells);
+    
+public:
+    // budget - час на хід без явного дедлайну (setMoveTime);
+    // threads - паралельних завдань семплювання на хід (0 - за розміром пулу,
+    // 1 - у потоці виклику без пулу); pool = nullptr - ThreadPool::shared()
+    MonteCarloAI(const std::string& aiName = "Monte Carlo AI",
+                 std::chrono::microseconds budget = std::chrono::milliseconds(50),
+                 int threads = 0, std::shared_ptr<ThreadPool> pool = nullptr);
+    
+    // Найкраща ціль, знайдена до deadline (без виводу в консоль)
+    using DensityAI::selectTarget;
+    Coordinate selectTarget(Clock::time_point deadline);
+    
+    // Найбільша кількість розстановок на хід (0 - лише дедлайн). З бюджетом,
+    // який встигає до дедлайну, хід залежить лише від зерна, а не від
+    // швидкості машини та кількості потоків
+    void setSampleBudget(long long samples) { sampleBudget = samples; }
+    long long getSampleBudget() const { return sampleBudget; }
+    
+    // Кількість розстановок, зібраних за останній хід
+    long long getLastSampleCount() const { return lastSampleCount; }
+    
+    // Семплює до самого deadline
+    using DensityAI::chooseTarget;
+    Coordinate chooseTarget(MoveClock::time_point deadline, Pace pace) override;
 };
 
 #endif // AI_H
\ No newline at end of file
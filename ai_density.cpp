@@ -0,0 +1,80 @@
+#include "ai.h"
+
+// ==================== DensityAI ====================
+
+DensityAI::DensityAI(const std::string& aiName)
+    : AIPlayer(aiName) {
+}
+
+void DensityAI::reset() {
+    AIPlayer::reset();
+    densityMap.reset();
+}
+
+Coordinate DensityAI::selectTarget() {
+    Coordinate target;
+    if (chooseBookTarget(target) || chooseEndgameTarget(target)) {
+        return target;
+    }
+
+    // Карту перебудовуємо, лише якщо trackingBoard змінювали в обхід processShotResult
+    if (!densityMap.isSyncedWith(trackingBoard)) {
+        densityMap.rebuild(trackingBoard);
+    }
+
+    ShipCounts counts;
+    remainingShips(counts);
+
+    Density density;
+    densityMap.combine(counts, density);
+
+    Board::Mask attacked = trackingBoard.getAttackedMask();
+
+    // Серед клітинок з найбільшою густиною вибираємо випадкову.
+    // Якщо суперника вже бачили, густину зважуємо його тепловою картою
+    int best = -1;
+    double bestValue = -1.0;
+    int ties = 0;
+
+    for (int index = 0; index < Board::CELLS; index++) {
+        if (attacked.test(index)) continue;
+
+        double value = hasOpponentPrior ? static_cast<double>(density[index]) * opponentPrior[index]
+                                        : density[index];
+        if (value > bestValue) {
+            bestValue = value;
+            best = index;
+            ties = 1;
+        } else if (value == bestValue) {
+            ties++;
+            if (std::uniform_int_distribution<>(0, ties - 1)(rng) == 0) {
+                best = index;
+            }
+        }
+    }
+
+    if (best < 0) {
+        return Coordinate(-1, -1);
+    }
+    return Coordinate(best / Board::COLS, best % Board::COLS);
+}
+
+Coordinate DensityAI::chooseTarget(MoveClock::time_point, Pace) {
+    Coordinate target = selectTarget();
+
+    if (!Board::contains(target)) {
+        return Coordinate(-1, -1);
+    }
+
+    return target;
+}
+
+void DensityAI::processShotResult(const Coordinate& coord, ShotResult result) {
+    bool synced = densityMap.isSyncedWith(trackingBoard);
+    Player::processShotResult(coord, result);
+
+    // Оновлюємо лише позиції, які зачіпає цей постріл
+    if (synced) {
+        densityMap.update(trackingBoard, coord, result);
+    }
+}
\ No newline at end of file
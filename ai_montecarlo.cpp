@@ -0,0 +1,233 @@
+#include "ai.h"
+#include "placement_table.h"
+#include <atomic>
+
+// ==================== MonteCarloAI ====================
+
+namespace {
+    // Розстановок між перевірками часу
+    const int SAMPLE_BATCH = 64;
+
+    // Випадкових спроб поставити корабель до повного перебору позицій
+    const int RANDOM_TRIES = 32;
+
+    // Прибрати перше входження розміру зі списку
+    bool takeSize(int* sizes, int& count, int size) {
+        for (int i = 0; i < count; i++) {
+            if (sizes[i] == size) {
+                sizes[i] = sizes[--count];
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+MonteCarloAI::MonteCarloAI(const std::string& aiName, std::chrono::microseconds budget, int threads,
+                           std::shared_ptr<ThreadPool> sharedPool)
+    : DensityAI(aiName), pool(sharedPool), parallelism(threads), sampleBudget(0), lastSampleCount(0) {
+    moveTime = budget;
+
+    // Один пул на процес: окремий пул на кожен AI створював би і зупиняв
+    // потоки для кожної партії
+    if (parallelism != 1 && !pool) {
+        pool = ThreadPool::shared();
+    }
+    if (parallelism <= 0) {
+        parallelism = pool->size();
+    }
+}
+
+bool MonteCarloAI::sampleLayout(const Observation& observation, std::mt19937& gen,
+                                Board::Mask& shipCells) {
+    const DensityMap::CellIndex& index = DensityMap::cellIndex();
+    const Board::Placement* entries = PlacementTable::ENTRIES<StandardGeometry>.data();
+
+    int sizes[StandardGeometry::FLEET_SIZE];
+    int left = observation.shipCount;
+    std::copy(observation.sizes, observation.sizes + left, sizes);
+
+    // Клітинки, куди новий корабель ставити не можна: заблоковані та
+    // зайняті вже поставленими кораблями разом з їх сусідами
+    Board::Mask occupied = observation.blocked;
+    Board::Mask uncovered = observation.openHits;
+    shipCells.clear();
+
+    uint16_t candidates[DensityMap::PLACEMENTS];
+
+    // 1. Кожне влучання має належати якомусь кораблю.
+    //    Беремо перше незакрите влучання і ставимо через нього випадковий корабель
+    while (uncovered.any()) {
+        int cell = uncovered.lowest();
+        int count = 0;
+
+        for (uint32_t i = index.footprintBegin[cell]; i < index.footprintBegin[cell + 1]; i++) {
+            const Board::Placement& p = entries[index.footprint[i]];
+            if (std::find(sizes, sizes + left, p.size) == sizes + left) continue;
+            if (p.footprint.intersects(occupied)) continue;
+            // Корабель не торкається чужих влучань і не складається лише з влучань (тоді він був би потоплений)
+            if (p.halo.without(p.footprint).intersects(observation.openHits)) continue;
+            if (p.footprint.without(observation.openHits).none()) continue;
+
+            candidates[count++] = index.footprint[i];
+        }
+
+        if (count == 0) return false;
+
+        const Board::Placement& chosen = entries[candidates[std::uniform_int_distribution<>(0, count - 1)(gen)]];
+        takeSize(sizes, left, chosen.size);
+        occupied |= chosen.halo;
+        uncovered = uncovered.without(chosen.footprint);
+        shipCells |= chosen.footprint;
+    }
+
+    // 2. Решту кораблів ставимо у вільні клітинки подалі від влучань
+    while (left > 0) {
+        int size = sizes[--left];
+        const Board::Placement* first = PlacementTable::begin<StandardGeometry>(size);
+        const Board::Placement* last = PlacementTable::end<StandardGeometry>(size);
+        int total = static_cast<int>(last - first);
+        if (total == 0) return false;
+
+        const Board::Placement* chosen = nullptr;
+        std::uniform_int_distribution<> pick(0, total - 1);
+        for (int attempt = 0; attempt < RANDOM_TRIES && !chosen; attempt++) {
+            const Board::Placement* p = first + pick(gen);
+            if (!p->footprint.intersects(occupied) && !p->halo.intersects(observation.openHits)) {
+                chosen = p;
+            }
+        }
+
+        // Вільного місця мало - перебираємо всі позиції
+        if (!chosen) {
+            int count = 0;
+            for (const Board::Placement* p = first; p != last; ++p) {
+                if (!p->footprint.intersects(occupied) && !p->halo.intersects(observation.openHits)) {
+                    candidates[count++] = static_cast<uint16_t>(p - entries);
+                }
+            }
+            if (count == 0) return false;
+            chosen = entries + candidates[std::uniform_int_distribution<>(0, count - 1)(gen)];
+        }
+
+        occupied |= chosen->halo;
+        shipCells |= chosen->footprint;
+    }
+
+    return true;
+}
+
+Coordinate MonteCarloAI::selectTarget(Clock::time_point deadline) {
+    Coordinate target;
+    if (chooseBookTarget(target) || chooseEndgameTarget(target)) {
+        lastSampleCount = 0;
+        return target;
+    }
+
+    Observation observation;
+    observation.blocked = trackingBoard.getNoShipMask();
+    observation.openHits = trackingBoard.getHitMask().without(trackingBoard.getSunkMask());
+
+    // Великі кораблі ставимо першими - так менше глухих кутів
+    ShipCounts counts;
+    remainingShips(counts);
+    observation.shipCount = 0;
+    for (int size = 1; size <= StandardGeometry::MAX_SHIP_SIZE; size++) {
+        for (int i = 0; i < counts[size]; i++) {
+            observation.sizes[observation.shipCount++] = size;
+        }
+    }
+
+    lastSampleCount = 0;
+    if (observation.shipCount == 0) {
+        return DensityAI::selectTarget();
+    }
+
+    // Кожен потік рахує у власні лічильники і додає їх до спільних наприкінці
+    std::array<std::atomic<uint32_t>, Board::CELLS> shipCounts;
+    for (std::atomic<uint32_t>& count : shipCounts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    std::atomic<long long> samples(0);
+
+    std::vector<uint32_t> seeds(parallelism);
+    for (uint32_t& seed : seeds) {
+        seed = rng();
+    }
+
+    // Бюджет розстановок ділимо між завданнями порівну
+    long long quota = sampleBudget > 0 ? (sampleBudget + parallelism - 1) / parallelism : 0;
+
+    auto sampleUntilDeadline = [&observation, &shipCounts, &samples, &seeds, deadline, quota](int worker) {
+        std::mt19937 gen(seeds[worker]);
+        std::array<uint32_t, Board::CELLS> local{};
+        long long localSamples = 0;
+        Board::Mask cells;
+
+        // Час перевіряємо перед кожною порцією, тож після дедлайну нових не починаємо
+        while (Clock::now() < deadline && (quota == 0 || localSamples < quota)) {
+            for (int i = 0; i < SAMPLE_BATCH && (quota == 0 || localSamples < quota); i++) {
+                if (!sampleLayout(observation, gen, cells)) continue;
+
+                cells.forEachSet([&local](int cell) { local[cell]++; });
+                localSamples++;
+            }
+        }
+
+        for (int cell = 0; cell < Board::CELLS; cell++) {
+            if (local[cell]) {
+                shipCounts[cell].fetch_add(local[cell], std::memory_order_relaxed);
+            }
+        }
+        samples.fetch_add(localSamples, std::memory_order_relaxed);
+    };
+
+    if (parallelism == 1) {
+        sampleUntilDeadline(0);
+    } else {
+        pool->run(parallelism, sampleUntilDeadline);
+    }
+
+    lastSampleCount = samples.load();
+    if (lastSampleCount == 0) {
+        return DensityAI::selectTarget();
+    }
+
+    // Стріляємо туди, де кораблі траплялись найчастіше (з урахуванням
+    // теплової карти суперника, якщо вона є)
+    Board::Mask attacked = trackingBoard.getAttackedMask();
+    int best = -1;
+    double bestValue = 0.0;
+    int ties = 0;
+
+    for (int cell = 0; cell < Board::CELLS; cell++) {
+        if (attacked.test(cell)) continue;
+
+        double value = static_cast<double>(shipCounts[cell].load(std::memory_order_relaxed)) * opponentPrior[cell];
+        if (best < 0 || value > bestValue) {
+            bestValue = value;
+            best = cell;
+            ties = 1;
+        } else if (value == bestValue) {
+            ties++;
+            if (std::uniform_int_distribution<>(0, ties - 1)(rng) == 0) {
+                best = cell;
+            }
+        }
+    }
+
+    if (best < 0) {
+        return Coordinate(-1, -1);
+    }
+    return Coordinate(best / Board::COLS, best % Board::COLS);
+}
+
+Coordinate MonteCarloAI::chooseTarget(Clock::time_point deadline, Pace) {
+    Coordinate target = selectTarget(deadline);
+
+    if (!Board::contains(target)) {
+        return Coordinate(-1, -1);
+    }
+
+    return target;
+}
\ No newline at end of file
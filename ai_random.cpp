@@ -1,19 +1,87 @@
 #include "ai.h"
-#include <iostream>
+#include "fleet_sampler.h"
 #include <algorithm>
+#include <thread>
 
 // ==================== AIPlayer (базовий клас) ====================
 
 AIPlayer::AIPlayer(const std::string& aiName) 
-    : Player(aiName) {
+    : Player(aiName), hasOpponentPrior(false), moveTime(std::chrono::seconds(1)), movePace(Pace::INTERACTIVE) {
+    opponentPrior.fill(1.0f);
     std::random_device rd;
     rng.seed(rd());
 }
 
+void AIPlayer::remainingShips(ShipCounts& counts) const {
+    counts.fill(0);
+    for (ShipType type : StandardGeometry::FLEET) {
+        counts[static_cast<int>(type)]++;
+    }
+    
+    // На tracking board лежать лише потоплені кораблі
+    for (const Ship& ship : trackingBoard.getShips()) {
+        if (ship.size <= StandardGeometry::MAX_SHIP_SIZE && counts[ship.size] > 0) {
+            counts[ship.size]--;
+        }
+    }
+}
+
+bool AIPlayer::chooseBookTarget(Coordinate& target) const {
+    if (!openingBook) {
+        return false;
+    }
+    
+    Coordinate bookTarget;
+    if (!openingBook->lookup(trackingBoard.getHash(), bookTarget) || !Board::contains(bookTarget) ||
+        trackingBoard.isAttacked(bookTarget)) {
+        return false;
+    }
+    
+    target = bookTarget;
+    return true;
+}
+
+bool AIPlayer::chooseEndgameTarget(Coordinate& target) {
+    if (endgame.getMaxLayouts() <= 0) {
+        return false;
+    }
+    
+    ShipCounts counts;
+    remainingShips(counts);
+    
+    EndgameSolver::Result result = endgame.solve(trackingBoard, counts);
+    if (!result.solved) {
+        return false;
+    }
+    
+    target = result.target;
+    return true;
+}
+
+void AIPlayer::thinkingPause(MoveClock::time_point deadline, Pace pace, std::chrono::milliseconds pause) {
+    if (pace == Pace::INTERACTIVE) {
+        std::this_thread::sleep_until(std::min(MoveClock::now() + pause, deadline));
+    }
+}
+
+Coordinate AIPlayer::chooseTarget() {
+    return chooseTarget(MoveClock::now() + moveTime, movePace);
+}
+
 void AIPlayer::placeShips() {
-    std::cout << Color::CYAN << name << " розміщує кораблі...\n" << Color::RESET;
-    ownBoard.placeShipsRandomly();
-    std::cout << Color::GREEN << "Кораблі розміщено!\n" << Color::RESET;
+    // Розстановка з бібліотеки, якщо вона є, інакше випадкова
+    if (placementLibrary && placementLibrary->place(ownBoard, rng)) {
+        return;
+    }
+    if (ownBoard.placeShipsRandomly(rng)) {
+        return;
+    }
+    
+    // Послідовний вибір позицій зайшов у глухий кут - точний семплер знайде
+    // розстановку, якщо вона взагалі існує
+    if (FleetSampler::forGeometry<StandardGeometry>().getLayoutCount() > 0) {
+        ownBoard.placeShipsUniformly(rng);
+    }
 }
 
 // ==================== RandomAI ====================
@@ -23,53 +91,26 @@ RandomAI::RandomAI(const std::string& aiName)
     initializeTargets();
 }
 
-void RandomAI::initializeTargets() {
-    availableTargets.clear();
-    
-    // Заповнюємо всі можливі координати
-    for (int row = 0; row < BOARD_SIZE; row++) {
-        for (int col = 0; col < BOARD_SIZE; col++) {
-            availableTargets.push_back(Coordinate(row, col));
-        }
-    }
-    
-    // Перемішуємо для випадковості
-    std::shuffle(availableTargets.begin(), availableTargets.end(), rng);
+void RandomAI::reset() {
+    AIPlayer::reset();
+    initializeTargets();
 }
 
-void RandomAI::removeTarget(const Coordinate& coord) {
-    // Видаляємо координату зі списку доступних
-    availableTargets.erase(
-        std::remove_if(availableTargets.begin(), availableTargets.end(),
-            [&coord](const Coordinate& c) {
-                return c.row == coord.row && c.col == coord.col;
-            }),
-        availableTargets.end()
-    );
+void RandomAI::initializeTargets() {
+    // Заповнюємо всі можливі координати; випадковість - при виборі цілі
+    availableTargets.fill();
 }
 
-Coordinate RandomAI::chooseTarget() {
-    std::cout << Color::CYAN << name << " обирає ціль...\n" << Color::RESET;
-    
+Coordinate RandomAI::chooseTarget(MoveClock::time_point deadline, Pace pace) {
     // Невелика затримка для реалістичності
-    #ifdef _WIN32
-        Sleep(500);  // Windows
-    #else
-        usleep(500000);  // Unix/Linux
-    #endif
+    thinkingPause(deadline, pace, std::chrono::milliseconds(500));
     
     if (availableTargets.empty()) {
         // Якщо всі цілі вичерпані (не повинно статися в нормальній грі)
-        std::cerr << "Error: No available targets!\n";
         return Coordinate(-1, -1);
     }
     
-    // Беремо останню ціль і видаляємо її
-    Coordinate target = availableTargets.back();
-    availableTargets.pop_back();
-    
-    std::cout << Color::YELLOW << name << " стріляє по " 
-              << char('A' + target.row) << target.col << "\n" << Color::RESET;
-    
-    return target;
+    // Беремо випадкову ціль і видаляємо її
+    int index = availableTargets.take(rng);
+    return Coordinate(index / Board::COLS, index % Board::COLS);
 }
\ No newline at end of file
@@ -1,12 +1,29 @@
 #include "ai.h"
-#include <iostream>
+#include "density_kernel.h"
 #include <algorithm>
 #include <cmath>
 
 // ==================== SmartAI ====================
 
 SmartAI::SmartAI(const std::string& aiName) 
-    : AIPlayer(aiName), currentMode(HUNT), lastHit(-1, -1) {
+    : AIPlayer(aiName), currentMode(HUNT), lastHit(-1, -1), densityHunt(false) {
+    SmartAI::reset();
+}
+
+void SmartAI::reset() {
+    AIPlayer::reset();
+    
+    currentMode = HUNT;
+    targetQueue = std::queue<Coordinate>();
+    lastHit = Coordinate(-1, -1);
+    currentShipHits.clear();
+    
+    for (Board::Mask& cells : huntCells) {
+        cells.clear();
+    }
+    for (int index = 0; index < Board::CELLS; index++) {
+        huntCells[(index / Board::COLS + index % Board::COLS) % 2].set(index);
+    }
 }
 
 std::vector<Coordinate> SmartAI::getAdjacentCells(const Coordinate& coord) const {
@@ -17,7 +34,7 @@ std::vector<Coordinate> SmartAI::getAdjacentCells(const Coordinate& coord) const
     
     for (const auto& dir : directions) {
         Coordinate newCoord(coord.row + dir[0], coord.col + dir[1]);
-        if (newCoord.isValid()) {
+        if (Board::contains(newCoord)) {
             adjacent.push_back(newCoord);
         }
     }
@@ -37,7 +54,7 @@ void SmartAI::addAdjacentTargets(const Coordinate& coord) {
 }
 
 bool SmartAI::isValidTarget(const Coordinate& coord) const {
-    if (!coord.isValid()) {
+    if (!Board::contains(coord)) {
         return false;
     }
     
@@ -97,78 +114,120 @@ void SmartAI::analyzeShipDirection() {
 Coordinate SmartAI::getSmartHuntTarget() {
     // Стратегія "шахової дошки" - стріляємо тільки по чорних клітинках
     // Це оптимально, оскільки найменший корабель має розмір 2
-    
-    std::vector<Coordinate> checkerboardTargets;
-    
-    for (int row = 0; row < BOARD_SIZE; row++) {
-        for (int col = 0; col < BOARD_SIZE; col++) {
-            // Вибираємо клітинки де (row + col) парне
-            if ((row + col) % 2 == 0) {
-                Coordinate coord(row, col);
-                if (isValidTarget(coord)) {
-                    checkerboardTargets.push_back(coord);
-                }
-            }
-        }
-    }
+    const Board::Mask* candidates = &huntCells[0];
     
     // Якщо шахові клітинки закінчились, беремо будь-яку доступну
-    if (checkerboardTargets.empty()) {
-        for (int row = 0; row < BOARD_SIZE; row++) {
-            for (int col = 0; col < BOARD_SIZE; col++) {
-                Coordinate coord(row, col);
-                if (isValidTarget(coord)) {
-                    checkerboardTargets.push_back(coord);
-                }
-            }
-        }
+    if (candidates->none()) {
+        candidates = &huntCells[1];
     }
     
-    if (checkerboardTargets.empty()) {
+    int count = candidates->count();
+    if (count == 0) {
         return Coordinate(-1, -1);
     }
     
-    // Вибираємо випадкову ціль з доступних
-    std::uniform_int_distribution<> dist(0, checkerboardTargets.size() - 1);
-    return checkerboardTargets[dist(rng)];
+    // За бажанням стріляємо туди, де кораблі можуть стояти найімовірніше
+    int index = densityHunt ? densestHuntCell(*candidates) : -1;
+    
+    if (index < 0) {
+        // Випадкова ціль з доступних
+        std::uniform_int_distribution<> dist(0, count - 1);
+        index = candidates->select(dist(rng));
+    }
+    return Coordinate(index / Board::COLS, index % Board::COLS);
 }
 
-Coordinate SmartAI::chooseTarget() {
-    std::cout << Color::CYAN << name << " аналізує ситуацію...\n" << Color::RESET;
+int SmartAI::densestHuntCell(const Board::Mask& candidates) {
+    ShipCounts counts;
+    remainingShips(counts);
+    
+    // Кораблі не стоять на обстріляних клітинках та поруч з потопленими
+    Board::Mask blocked = trackingBoard.getNoShipMask() | trackingBoard.getHitMask();
+    
+    uint16_t freeRows[Board::ROWS];
+    for (int row = 0; row < Board::ROWS; row++) {
+        uint64_t rowBlocked = blocked.extract(row * Board::COLS, Board::COLS);
+        freeRows[row] = static_cast<uint16_t>(~rowBlocked);
+    }
+    
+    DensityMap::Density density;
+    if (!DensityKernel::countPlacements(freeRows, Board::ROWS, Board::COLS,
+                                        counts.data(), StandardGeometry::MAX_SHIP_SIZE,
+                                        density.data())) {
+        return -1;
+    }
+    
+    // Серед клітинок з найбільшою густиною вибираємо випадкову
+    int best = -1;
+    int bestValue = -1;
+    int ties = 0;
+    
+    candidates.forEachSet([&](int index) {
+        if (density[index] > bestValue) {
+            bestValue = density[index];
+            best = index;
+            ties = 1;
+        } else if (density[index] == bestValue) {
+            ties++;
+            if (std::uniform_int_distribution<>(0, ties - 1)(rng) == 0) {
+                best = index;
+            }
+        }
+    });
     
+    return best;
+}
+
+Coordinate SmartAI::chooseTarget(MoveClock::time_point deadline, Pace pace) {
     // Невелика затримка для реалістичності
-    #ifdef _WIN32
-        Sleep(700);  // Windows
-    #else
-        usleep(700000);  // Unix/Linux
-    #endif
+    thinkingPause(deadline, pace, std::chrono::milliseconds(700));
     
     Coordinate target;
     
+    // Позиція є в книзі дебютів
+    if (chooseBookTarget(target)) {
+        return target;
+    }
+    
+    // Можливих розстановок залишилось мало - рахуємо найкращий постріл точно
+    if (chooseEndgameTarget(target)) {
+        return target;
+    }
+    
+    // Цілі з черги могли вже бути обстріляні в режимі кінця гри
+    while (!targetQueue.empty() && !isValidTarget(targetQueue.front())) {
+        targetQueue.pop();
+    }
+    
     if (currentMode == TARGET && !targetQueue.empty()) {
         // Режим добивання - беремо ціль з черги
         target = targetQueue.front();
         targetQueue.pop();
-        
-        std::cout << Color::YELLOW << name << " продовжує добивати корабель -> " 
-                  << char('A' + target.row) << target.col << "\n" << Color::RESET;
     } else {
         // Режим пошуку - використовуємо розумну стратегію
         currentMode = HUNT;
         target = getSmartHuntTarget();
         
-        if (!target.isValid()) {
-            std::cerr << "Error: No valid targets available!\n";
+        if (!Board::contains(target)) {
             return Coordinate(-1, -1);
         }
-        
-        std::cout << Color::YELLOW << name << " шукає кораблі -> " 
-                  << char('A' + target.row) << target.col << "\n" << Color::RESET;
     }
     
     return target;
 }
 
+void SmartAI::processShotResult(const Coordinate& coord, ShotResult result) {
+    // Стан добивання оновлюється до запису пострілу, як і раніше
+    updateAfterShot(coord, result);
+    Player::processShotResult(coord, result);
+    
+    // Ті самі кандидати, що й у повному скануванні isValidTarget
+    Board::Mask attacked = trackingBoard.getAttackedMask();
+    for (Board::Mask& cells : huntCells) {
+        cells = cells.without(attacked);
+    }
+}
+
 void SmartAI::updateAfterShot(const Coordinate& coord, ShotResult result) {
     switch (result) {
         case SHOT_HIT:
@@ -184,8 +243,6 @@ void SmartAI::updateAfterShot(const Coordinate& coord, ShotResult result) {
                 // Перше влучання - додаємо всі сусідні клітинки
                 addAdjacentTargets(coord);
             }
-            
-            std::cout << Color::GREEN << "AI: Влучання! Продовжую атаку...\n" << Color::RESET;
             break;
             
         case SHOT_SUNK:
@@ -197,13 +254,9 @@ void SmartAI::updateAfterShot(const Coordinate& coord, ShotResult result) {
             while (!targetQueue.empty()) {
                 targetQueue.pop();
             }
-            
-            std::cout << Color::RED << "AI: Корабель знищено! Шукаю наступну ціль...\n" << Color::RESET;
             break;
             
         case SHOT_MISS:
-            std::cout << Color::GRAY << "AI: Промах...\n" << Color::RESET;
-            
             // Якщо в режимі добивання і черга порожня, повертаємось до пошуку
             if (currentMode == TARGET && targetQueue.empty()) {
                 currentMode = HUNT;
@@ -211,11 +264,7 @@ void SmartAI::updateAfterShot(const Coordinate& coord, ShotResult result) {
             break;
             
         case SHOT_WIN:
-            std::cout << Color::GREEN << "AI переміг!\n" << Color::RESET;
-            break;
-            
         case SHOT_INVALID:
-            std::cerr << "AI Error: Invalid shot!\n";
             break;
     }
 }
\ No newline at end of file
@@ -0,0 +1,192 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <cstdint>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+#ifdef __BMI2__
+    #include <immintrin.h>
+#endif
+
+// Кількість встановлених бітів у 64-бітному слові
+inline int popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<int>(__popcnt64(x));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// Номер наймолодшого встановленого біта (x != 0)
+inline int countTrailingZeros64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<int>(index);
+#else
+    int index = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+// Номер n-го (з нуля) встановленого біта слова (n < popcount64(x))
+inline int selectBit64(uint64_t x, int n) {
+#ifdef __BMI2__
+    return countTrailingZeros64(_pdep_u64(uint64_t(1) << n, x));
+#else
+    for (int i = 0; i < n; i++) {
+        x &= x - 1;
+    }
+    return countTrailingZeros64(x);
+#endif
+}
+
+// Бітова маска фіксованої ширини: один біт на клітинку дошки.
+// Зберігається всередині об'єкта, тому копіюється без виділення пам'яті.
+template <int Bits>
+struct BitBoard {
+    static constexpr int WORDS = (Bits + 63) / 64;
+
+    uint64_t words[WORDS];
+
+    constexpr BitBoard() : words{} {}
+
+    constexpr void set(int index) {
+        words[index >> 6] |= uint64_t(1) << (index & 63);
+    }
+
+    constexpr void reset(int index) {
+        words[index >> 6] &= ~(uint64_t(1) << (index & 63));
+    }
+
+    constexpr bool test(int index) const {
+        return (words[index >> 6] >> (index & 63)) & 1;
+    }
+
+    // count бітів, починаючи з first (count <= 64), молодшими бітами результату
+    constexpr uint64_t extract(int first, int count) const {
+        int word = first >> 6;
+        int shift = first & 63;
+        uint64_t value = words[word] >> shift;
+        if (shift + count > 64 && word + 1 < WORDS) {
+            value |= words[word + 1] << (64 - shift);
+        }
+        return count == 64 ? value : value & ((uint64_t(1) << count) - 1);
+    }
+
+    void clear() {
+        for (int i = 0; i < WORDS; i++) {
+            words[i] = 0;
+        }
+    }
+
+    bool any() const {
+        for (int i = 0; i < WORDS; i++) {
+            if (words[i]) return true;
+        }
+        return false;
+    }
+
+    bool none() const { return !any(); }
+
+    // Кількість встановлених бітів
+    int count() const {
+        int total = 0;
+        for (int i = 0; i < WORDS; i++) {
+            total += popcount64(words[i]);
+        }
+        return total;
+    }
+
+    // Номер наймолодшого встановленого біта або -1, якщо маска порожня
+    int lowest() const {
+        for (int i = 0; i < WORDS; i++) {
+            if (words[i]) return i * 64 + countTrailingZeros64(words[i]);
+        }
+        return -1;
+    }
+
+    // Номер n-го (з нуля) встановленого біта або -1, якщо бітів не більше n
+    int select(int n) const {
+        for (int i = 0; i < WORDS; i++) {
+            int bits = popcount64(words[i]);
+            if (n < bits) return i * 64 + selectBit64(words[i], n);
+            n -= bits;
+        }
+        return -1;
+    }
+
+    // Викликати visit(index) для кожного встановленого біта за зростанням
+    template <typename Visitor>
+    void forEachSet(Visitor visit) const {
+        for (int i = 0; i < WORDS; i++) {
+            uint64_t word = words[i];
+            while (word) {
+                visit(i * 64 + countTrailingZeros64(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+    // Чи є спільні біти з іншою маскою
+    bool intersects(const BitBoard& other) const {
+        for (int i = 0; i < WORDS; i++) {
+            if (words[i] & other.words[i]) return true;
+        }
+        return false;
+    }
+
+    constexpr BitBoard& operator|=(const BitBoard& other) {
+        for (int i = 0; i < WORDS; i++) words[i] |= other.words[i];
+        return *this;
+    }
+
+    constexpr BitBoard& operator&=(const BitBoard& other) {
+        for (int i = 0; i < WORDS; i++) words[i] &= other.words[i];
+        return *this;
+    }
+
+    constexpr BitBoard operator|(const BitBoard& other) const {
+        BitBoard result = *this;
+        result |= other;
+        return result;
+    }
+
+    constexpr BitBoard operator&(const BitBoard& other) const {
+        BitBoard result = *this;
+        result &= other;
+        return result;
+    }
+
+    // Біти цієї маски, яких немає в іншій (this & ~other)
+    constexpr BitBoard without(const BitBoard& other) const {
+        BitBoard result = *this;
+        for (int i = 0; i < WORDS; i++) result.words[i] &= ~other.words[i];
+        return result;
+    }
+
+    bool operator==(const BitBoard& other) const {
+        for (int i = 0; i < WORDS; i++) {
+            if (words[i] != other.words[i]) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const BitBoard& other) const { return !(*this == other); }
+};
+
+#endif // BITBOARD_H
\ No newline at end of file
@@ -2,49 +2,155 @@
 #define BOARD_H
 
 #include "common.h"
+#include "bitboard.h"
+#include "placement_table.h"
+#include "zobrist.h"
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <string>
+#include <random>
 
-class Board {
+// Маска клітинок стандартної дошки (біт row * BOARD_SIZE + col)
+typedef BitBoard<StandardGeometry::CELLS> CellMask;
+
+// Ігрова дошка заданої геометрії. Реалізація - в board_impl.h;
+// стандартна дошка інстанціюється один раз у board.cpp
+template <typename Geometry>
+class BasicBoard {
+public:
+    // Маска клітинок дошки (біт row * COLS + col)
+    typedef BitBoard<Geometry::CELLS> Mask;
+    typedef BasicPlacement<Geometry> Placement;
+    
+    static constexpr int ROWS = Geometry::ROWS;
+    static constexpr int COLS = Geometry::COLS;
+    static constexpr int CELLS = Geometry::CELLS;
+    
+    // Найбільша кількість позицій одного корабля на дошці
+    static constexpr int MAX_PLACEMENTS_PER_SIZE = 2 * CELLS;
+    
+    static_assert(CELLS <= INT16_MAX, "Dense board is too large, use SparseBoard");
+    
+    // Журнал відкату пострілів applyShot. Належить тому, хто шукає, а не
+    // дошці, тож копії дошки лишаються компактними. Кожну клітинку можна
+    // обстріляти лише раз, тому CELLS записів завжди достатньо
+    class UndoLog {
+    public:
+        UndoLog() : size(0) {}
+        
+        // Кількість пострілів у журналі
+        int depth() const { return size; }
+        
+    private:
+        friend class BasicBoard;
+        
+        struct Entry {
+            int16_t index;   // Клітинка пострілу
+            bool hit;        // Влучання чи промах
+            bool sunk;       // Постріл потопив корабель
+        };
+        
+        std::array<Entry, CELLS> entries;
+        int size;
+    };
+    
 private:
-    // Ігрове поле
-    std::vector<std::vector<CellState>> grid;
+    // Ігрове поле у вигляді бітових масок
+    Mask shipMask;   // Клітинки з кораблями
+    Mask missMask;   // Промахи
+    Mask hitMask;    // Влучання
+    Mask sunkMask;   // Клітинки потоплених кораблів
+    
+    // Zobrist-хеш стану клітинок та потоплених кораблів
+    uint64_t hash;
     
     // Кораблі на дошці
     std::vector<Ship> ships;
     
-    // Перевірка чи можна розмістити корабель
-    bool canPlaceShip(const Ship& ship) const;
+    // Індекс корабля в ships для кожної клітинки (-1 - немає корабля)
+    std::array<int8_t, CELLS> shipIndex;
+    
+    // Статистика, яка оновлюється в shoot, placeShip та clear
+    int liveShips;    // Кількість непотоплених кораблів
+    int totalHits;    // Кількість влучань
+    int totalMisses;  // Кількість промахів
+    
+    // Порівнює лічильники та хеш з повним перерахунком дошки (O(CELLS)).
+    // Увімкнено лише при SEABATTLE_CHECK_BOARD, щоб звичайні збірки не платили
+    // повним скануванням за кожен постріл
+    void checkCounters() const;
+    
+    // Позиція корабля в таблиці позицій (nullptr якщо виходить за межі дошки)
+    static const Placement* placementOf(const Ship& ship);
+    
+    // Один прохід розміщення флоту (false якщо позицій не залишилось)
+    bool tryPlaceFleet(std::mt19937& gen);
+    
+    // Скільки проходів tryPlaceFleet робить placeShipsRandomly перед тим, як здатися
+    static constexpr int MAX_FLEET_ATTEMPTS = 1000;
     
     // Перевірка чи клітинки навколо вільні (для правила сусідства)
     bool hasAdjacentShips(const Coordinate& coord) const;
+    
+    // Маска 8 сусідніх клітинок для кожної клітинки дошки
+    static const Mask& neighbourMask(int index);
+    
+    // Позначити клітинки потопленого корабля та зняти позначку
+    void markSunk(const Ship& ship);
+    void unmarkSunk(const Ship& ship);
+    
+    // Потоплений корабль, відновлений з ланцюжка влучань через coord
+    Ship sunkShipAt(const Coordinate& coord) const;
 
 public:
     // Конструктор
-    Board();
+    BasicBoard();
     
     // Очистити дошку
     void clear();
     
+    // Перевірка чи можна розмістити корабель
+    bool canPlaceShip(const Ship& ship) const;
+    
     // Розмістити корабель
     bool placeShip(const Ship& ship);
     bool placeShip(ShipType type, Coordinate start, Orientation orientation);
     
-    // Автоматичне розміщення всіх кораблів
-    void placeShipsRandomly();
+    // Автоматичне розміщення всіх кораблів. Позиції вибираються по черзі,
+    // тому різні розстановки мають різну ймовірність.
+    // false - флот не вмістився за MAX_FLEET_ATTEMPTS спроб (дошка залишається порожньою)
+    bool placeShipsRandomly();
+    bool placeShipsRandomly(std::mt19937& gen);
+    
+    // Розміщення флоту, рівномірне серед усіх допустимих розстановок.
+    // Перший виклик будує таблиці FleetSampler (для 10x10 приблизно секунда)
+    void placeShipsUniformly();
+    void placeShipsUniformly(std::mt19937& gen);
     
     // Постріл по координатам
     ShotResult shoot(const Coordinate& coord);
     
+    // Постріл з записом у журнал відкату (для пошуку без копіювання дошки).
+    // undoShot скасовує останній постріл журналу: стан клітинки, влучання
+    // корабля, статистику та хеш. Журнал має вестися лише для цієї дошки
+    // і без clear/placeShip між записами. Повертає false, якщо журнал порожній
+    ShotResult applyShot(const Coordinate& coord, UndoLog& log);
+    bool undoShot(UndoLog& log);
+    
+    // Записати результат пострілу по дошці противника, де кораблі невідомі.
+    // Потоплений корабель відновлюється з влучань і додається до getShips()
+    bool recordShot(const Coordinate& coord, ShotResult result);
+    
     // Отримати стан клітинки
     CellState getCell(const Coordinate& coord) const;
     CellState getCell(int row, int col) const;
     
     // Перевірка чи всі кораблі потоплені
-    bool allShipsSunk() const;
+    bool allShipsSunk() const { return liveShips == 0; }
     
     // Отримати кількість живих кораблів
-    int getRemainingShips() const;
+    int getRemainingShips() const { return liveShips; }
     
     // Отримати всі кораблі
     const std::vector<Ship>& getShips() const { return ships; }
@@ -55,12 +161,37 @@ public:
     // Перевірка чи координата вже атакована
     bool isAttacked(const Coordinate& coord) const;
     
+    // Маски стану дошки
+    const Mask& getShipMask() const { return shipMask; }
+    const Mask& getMissMask() const { return missMask; }
+    const Mask& getHitMask() const { return hitMask; }
+    const Mask& getSunkMask() const { return sunkMask; }
+    Mask getAttackedMask() const { return missMask | hitMask; }
+    
+    // Клітинки, де точно немає непотоплених кораблів: промахи, потоплені
+    // кораблі та клітинки навколо них
+    Mask getNoShipMask() const;
+    
+    // Чи лежить координата на цій дошці
+    static constexpr bool contains(const Coordinate& coord) { return coord.isValidIn<Geometry>(); }
+    
+    // Індекс клітинки в масках
+    static constexpr int cellIndex(const Coordinate& coord) { return coord.row * COLS + coord.col; }
+    
+    // 64-бітний хеш позиції для кешів та пошуку повторів
+    uint64_t getHash() const { return hash; }
+    
     // Отримати статистику
-    int getTotalHits() const;
-    int getTotalMisses() const;
+    int getTotalHits() const { return totalHits; }
+    int getTotalMisses() const { return totalMisses; }
     
     // Для дебагу - вивести дошку з кораблями
     void debugDisplay() const;
 };
 
+// Стандартна дошка 10x10
+typedef BasicBoard<StandardGeometry> Board;
+
+extern template class BasicBoard<StandardGeometry>;
+
 #endif // BOARD_H
\ No newline at end of file
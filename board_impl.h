@@ -0,0 +1,467 @@
+#ifndef BOARD_IMPL_H
+#define BOARD_IMPL_H
+
+// Реалізація BasicBoard. Підключається лише там, де дошка інстанціюється:
+// у board.cpp для стандартної геометрії та в режимах з іншими розмірами
+
+#include "board.h"
+#include "placement_table.h"
+#include "fleet_sampler.h"
+#include <iostream>
+#include <random>
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+template <typename Geometry>
+BasicBoard<Geometry>::BasicBoard() {
+    ships.reserve(Geometry::FLEET_SIZE);
+    clear();
+}
+
+template <typename Geometry>
+void BasicBoard<Geometry>::clear() {
+    // Ініціалізуємо порожнє поле
+    shipMask.clear();
+    missMask.clear();
+    hitMask.clear();
+    sunkMask.clear();
+    hash = 0;
+    ships.clear();
+    shipIndex.fill(-1);
+    liveShips = 0;
+    totalHits = 0;
+    totalMisses = 0;
+}
+
+template <typename Geometry>
+void BasicBoard<Geometry>::checkCounters() const {
+#ifdef SEABATTLE_CHECK_BOARD
+    uint64_t expectedHash = 0;
+    for (int i = 0; i < CELLS; i++) {
+        if (shipMask.test(i)) expectedHash ^= Zobrist::KEYS<CELLS>.ship[i];
+        if (missMask.test(i)) expectedHash ^= Zobrist::KEYS<CELLS>.miss[i];
+        if (hitMask.test(i)) expectedHash ^= Zobrist::KEYS<CELLS>.hit[i];
+        if (sunkMask.test(i)) expectedHash ^= Zobrist::KEYS<CELLS>.sunk[i];
+    }
+    assert(expectedHash == hash);
+    
+    int live = 0;
+    for (const Ship& ship : ships) {
+        if (!ship.isSunk()) live++;
+    }
+    
+    assert(live == liveShips);
+    assert(hitMask.count() == totalHits);
+    assert(missMask.count() == totalMisses);
+#endif
+}
+
+template <typename Geometry>
+const typename BasicBoard<Geometry>::Mask& BasicBoard<Geometry>::neighbourMask(int index) {
+    // Таблиця будується один раз при першому зверненні
+    static const std::array<Mask, CELLS> table = [] {
+        std::array<Mask, CELLS> masks;
+        for (int row = 0; row < ROWS; row++) {
+            for (int col = 0; col < COLS; col++) {
+                Mask& mask = masks[cellIndex(Coordinate(row, col))];
+                for (int dr = -1; dr <= 1; dr++) {
+                    for (int dc = -1; dc <= 1; dc++) {
+                        if (dr == 0 && dc == 0) continue;
+                        
+                        Coordinate neighbour(row + dr, col + dc);
+                        if (contains(neighbour)) {
+                            mask.set(cellIndex(neighbour));
+                        }
+                    }
+                }
+            }
+        }
+        return masks;
+    }();
+    return table[index];
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::hasAdjacentShips(const Coordinate& coord) const {
+    // Перевіряємо всі 8 сусідніх клітинок однією операцією над масками
+    return neighbourMask(cellIndex(coord)).intersects(shipMask);
+}
+
+template <typename Geometry>
+const typename BasicBoard<Geometry>::Placement* BasicBoard<Geometry>::placementOf(const Ship& ship) {
+    int index = PlacementTable::indexOf<Geometry>(ship.size, ship.start, ship.orientation);
+    if (index < 0) {
+        return nullptr;
+    }
+    return &PlacementTable::ENTRIES<Geometry>[index];
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::canPlaceShip(const Ship& ship) const {
+    // Перевірка меж
+    const Placement* placement = placementOf(ship);
+    if (!placement) {
+        return false;
+    }
+    
+    // Перевірка чи клітинки вільні
+    if (placement->footprint.intersects(shipMask | missMask | hitMask)) {
+        return false;
+    }
+    
+    // Перевірка сусідів (кораблі не можуть торкатися)
+    return !placement->halo.intersects(shipMask);
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::placeShip(const Ship& ship) {
+    if (!canPlaceShip(ship)) {
+        return false;
+    }
+    
+    // Розміщуємо корабель
+    int8_t index = static_cast<int8_t>(ships.size());
+    for (Coordinate coord : ship.cells()) {
+        shipMask.set(cellIndex(coord));
+        shipIndex[cellIndex(coord)] = index;
+        hash ^= Zobrist::KEYS<CELLS>.ship[cellIndex(coord)];
+    }
+    
+    ships.push_back(ship);
+    if (!ship.isSunk()) {
+        liveShips++;
+    }
+    
+    checkCounters();
+    return true;
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::placeShip(ShipType type, Coordinate start, Orientation orientation) {
+    Ship ship(type, start, orientation);
+    return placeShip(ship);
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::placeShipsRandomly() {
+    // Генератор створюється один раз для кожного потоку
+    static thread_local std::mt19937 gen(std::random_device{}());
+    return placeShipsRandomly(gen);
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::placeShipsRandomly(std::mt19937& gen) {
+    // Для стандартного флоту (від більших кораблів до менших) повний перебір
+    // розстановок показав, що вільна позиція є завжди, тож вистачає одного проходу.
+    // Ліміт потрібен для геометрій, де флот не вміщується взагалі
+    for (int attempt = 0; attempt < MAX_FLEET_ATTEMPTS; attempt++) {
+        if (tryPlaceFleet(gen)) {
+            return true;
+        }
+    }
+    
+    clear();
+    return false;
+}
+
+template <typename Geometry>
+void BasicBoard<Geometry>::placeShipsUniformly() {
+    static thread_local std::mt19937 gen(std::random_device{}());
+    placeShipsUniformly(gen);
+}
+
+template <typename Geometry>
+void BasicBoard<Geometry>::placeShipsUniformly(std::mt19937& gen) {
+    FleetSampler::forGeometry<Geometry>().sample(*this, gen);
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::tryPlaceFleet(std::mt19937& gen) {
+    clear();
+    
+    // Клітинки розміщених кораблів разом із сусідніми
+    Mask blocked;
+    std::array<const Placement*, MAX_PLACEMENTS_PER_SIZE> candidates;
+    
+    // Розміщуємо кожен тип корабля флоту
+    for (ShipType type : Geometry::FLEET) {
+        int size = static_cast<int>(type);
+        
+        // Збираємо всі позиції, які ще вільні
+        int count = 0;
+        const Placement* first = PlacementTable::begin<Geometry>(size);
+        const Placement* last = PlacementTable::end<Geometry>(size);
+        for (const Placement* p = first; p != last; ++p) {
+            if (!p->footprint.intersects(blocked)) {
+                candidates[count++] = p;
+            }
+        }
+        
+        if (count == 0) {
+            return false;
+        }
+        
+        std::uniform_int_distribution<> dist(0, count - 1);
+        const Placement* chosen = candidates[dist(gen)];
+        
+        placeShip(Ship(type, chosen->start, chosen->orientation));
+        blocked |= chosen->halo;
+    }
+    
+    return true;
+}
+
+template <typename Geometry>
+ShotResult BasicBoard<Geometry>::shoot(const Coordinate& coord) {
+    if (!contains(coord)) {
+        return SHOT_INVALID;
+    }
+    
+    int index = cellIndex(coord);
+    
+    // Перевіряємо чи вже стріляли тут
+    if (missMask.test(index) || hitMask.test(index)) {
+        return SHOT_INVALID;
+    }
+    
+    // Промах
+    if (!shipMask.test(index)) {
+        missMask.set(index);
+        hash ^= Zobrist::KEYS<CELLS>.miss[index];
+        totalMisses++;
+        checkCounters();
+        return SHOT_MISS;
+    }
+    
+    // Влучання - корабель знаходимо за індексом клітинки
+    hitMask.set(index);
+    hash ^= Zobrist::KEYS<CELLS>.hit[index];
+    totalHits++;
+    
+    Ship& ship = ships[shipIndex[index]];
+    ship.hits++;
+    
+    if (!ship.isSunk()) {
+        checkCounters();
+        return SHOT_HIT;
+    }
+    
+    // Корабель потоплено - перевіряємо чи залишились живі кораблі
+    markSunk(ship);
+    liveShips--;
+    checkCounters();
+    if (liveShips == 0) {
+        return SHOT_WIN;
+    }
+    return SHOT_SUNK;
+}
+
+template <typename Geometry>
+void BasicBoard<Geometry>::markSunk(const Ship& ship) {
+    for (Coordinate coord : ship.cells()) {
+        sunkMask.set(cellIndex(coord));
+        hash ^= Zobrist::KEYS<CELLS>.sunk[cellIndex(coord)];
+    }
+}
+
+template <typename Geometry>
+void BasicBoard<Geometry>::unmarkSunk(const Ship& ship) {
+    for (Coordinate coord : ship.cells()) {
+        sunkMask.reset(cellIndex(coord));
+        hash ^= Zobrist::KEYS<CELLS>.sunk[cellIndex(coord)];
+    }
+}
+
+template <typename Geometry>
+ShotResult BasicBoard<Geometry>::applyShot(const Coordinate& coord, UndoLog& log) {
+    ShotResult result = shoot(coord);
+    if (result == SHOT_INVALID) {
+        return result;
+    }
+    
+    typename UndoLog::Entry& entry = log.entries[log.size++];
+    entry.index = static_cast<int16_t>(cellIndex(coord));
+    entry.hit = result != SHOT_MISS;
+    entry.sunk = result == SHOT_SUNK || result == SHOT_WIN;
+    return result;
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::undoShot(UndoLog& log) {
+    if (log.size == 0) {
+        return false;
+    }
+    
+    const typename UndoLog::Entry& entry = log.entries[--log.size];
+    int index = entry.index;
+    
+    if (!entry.hit) {
+        missMask.reset(index);
+        hash ^= Zobrist::KEYS<CELLS>.miss[index];
+        totalMisses--;
+        checkCounters();
+        return true;
+    }
+    
+    hitMask.reset(index);
+    hash ^= Zobrist::KEYS<CELLS>.hit[index];
+    totalHits--;
+    
+    Ship& ship = ships[shipIndex[index]];
+    if (entry.sunk) {
+        unmarkSunk(ship);
+        liveShips++;
+    }
+    ship.hits--;
+    
+    checkCounters();
+    return true;
+}
+
+template <typename Geometry>
+Ship BasicBoard<Geometry>::sunkShipAt(const Coordinate& coord) const {
+    // Влучання, яке ще не належить потопленому кораблю
+    auto openHit = [this](int row, int col) {
+        Coordinate c(row, col);
+        return contains(c) && hitMask.test(cellIndex(c)) && !sunkMask.test(cellIndex(c));
+    };
+    
+    int left = 0, right = 0, up = 0, down = 0;
+    while (openHit(coord.row, coord.col - left - 1)) left++;
+    while (openHit(coord.row, coord.col + right + 1)) right++;
+    while (openHit(coord.row - up - 1, coord.col)) up++;
+    while (openHit(coord.row + down + 1, coord.col)) down++;
+    
+    // Кораблі не торкаються, тому влучання лежать лише в одному напрямку
+    Ship ship;
+    if (left + right > 0) {
+        ship = Ship(static_cast<ShipType>(left + right + 1), Coordinate(coord.row, coord.col - left), HORIZONTAL);
+    } else {
+        ship = Ship(static_cast<ShipType>(up + down + 1), Coordinate(coord.row - up, coord.col), VERTICAL);
+    }
+    ship.hits = ship.size;
+    return ship;
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::recordShot(const Coordinate& coord, ShotResult result) {
+    if (!contains(coord) || result == SHOT_INVALID) {
+        return false;
+    }
+    
+    int index = cellIndex(coord);
+    if (missMask.test(index) || hitMask.test(index)) {
+        return false;
+    }
+    
+    if (result == SHOT_MISS) {
+        missMask.set(index);
+        hash ^= Zobrist::KEYS<CELLS>.miss[index];
+        totalMisses++;
+        checkCounters();
+        return true;
+    }
+    
+    hitMask.set(index);
+    hash ^= Zobrist::KEYS<CELLS>.hit[index];
+    totalHits++;
+    
+    if (result == SHOT_SUNK || result == SHOT_WIN) {
+        Ship ship = sunkShipAt(coord);
+        markSunk(ship);
+        ships.push_back(ship);
+    }
+    
+    checkCounters();
+    return true;
+}
+
+template <typename Geometry>
+CellState BasicBoard<Geometry>::getCell(const Coordinate& coord) const {
+    if (!contains(coord)) {
+        return EMPTY;
+    }
+    
+    int index = cellIndex(coord);
+    if (hitMask.test(index)) return HIT;
+    if (missMask.test(index)) return MISS;
+    if (shipMask.test(index)) return SHIP;
+    return EMPTY;
+}
+
+template <typename Geometry>
+CellState BasicBoard<Geometry>::getCell(int row, int col) const {
+    return getCell(Coordinate(row, col));
+}
+
+template <typename Geometry>
+void BasicBoard<Geometry>::display(bool hideShips) const {
+    std::cout << "  ";
+    for (int i = 0; i < COLS; i++) {
+        std::cout << " " << i;
+    }
+    std::cout << "\n";
+    
+    for (int row = 0; row < ROWS; row++) {
+        std::cout << char('A' + row) << " ";
+        
+        for (int col = 0; col < COLS; col++) {
+            CellState cell = getCell(row, col);
+            
+            if (hideShips && cell == SHIP) {
+                std::cout << " ~";  // Ховаємо кораблі противника
+            } else {
+                switch (cell) {
+                    case EMPTY:
+                        std::cout << " ~";
+                        break;
+                    case SHIP:
+                        std::cout << Color::BLUE << " S" << Color::RESET;
+                        break;
+                    case MISS:
+                        std::cout << Color::GRAY << " o" << Color::RESET;
+                        break;
+                    case HIT:
+                        std::cout << Color::RED << " X" << Color::RESET;
+                        break;
+                }
+            }
+        }
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+}
+
+template <typename Geometry>
+bool BasicBoard<Geometry>::isAttacked(const Coordinate& coord) const {
+    if (!contains(coord)) {
+        return false;
+    }
+    
+    int index = cellIndex(coord);
+    return missMask.test(index) || hitMask.test(index);
+}
+
+template <typename Geometry>
+typename BasicBoard<Geometry>::Mask BasicBoard<Geometry>::getNoShipMask() const {
+    Mask mask = missMask;
+    for (const Ship& ship : ships) {
+        if (ship.isSunk()) {
+            mask |= placementOf(ship)->halo;
+        }
+    }
+    return mask;
+}
+
+template <typename Geometry>
+void BasicBoard<Geometry>::debugDisplay() const {
+    std::cout << "=== DEBUG: Board State ===\n";
+    display(false);
+    std::cout << "Ships: " << ships.size() << "\n";
+    std::cout << "Remaining: " << getRemainingShips() << "\n";
+    std::cout << "Hits: " << getTotalHits() << "\n";
+    std::cout << "Misses: " << getTotalMisses() << "\n";
+}
+
+#endif // BOARD_IMPL_H
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "network.h"
 #include "player.h"
 #include "board.h"
+#include "game_engine.h"
 #include <iostream>
 #include <cstring>
 
@@ -10,6 +11,7 @@ void pause();
 void printTitle();
 void displayVictory(const std::string& winner);
 void displayMatchStats(const Player& player1, const Player& player2);
+void displayShotResult(ShotResult result);
 
 // ==================== GameClient Implementation ====================
 
@@ -74,6 +76,63 @@ void GameClient::disconnect() {
 
 // ==================== Main Client Program ====================
 
+// Консольний вигляд мережевої гри з боку клієнта
+class ClientConsoleView : public GameObserver {
+private:
+    int localSeat;
+    
+public:
+    explicit ClientConsoleView(int seat) : localSeat(seat) {}
+    
+    void onShipsPlaced(const GameEngine&, int seat) override {
+        if (seat == localSeat) {
+            std::cout << Color::YELLOW << "\nОчікування початку гри...\n" << Color::RESET;
+        }
+    }
+    
+    void onTurnStarted(const GameEngine& game, int seat) override {
+        clearScreen();
+        
+        if (seat == localSeat) {
+            std::cout << Color::CYAN << "=== ВАШ ХІД #" << game.getTurnNumber() << " ===\n" << Color::RESET;
+            game.getPlayer(seat).displayBothBoards();
+        } else {
+            std::cout << Color::YELLOW << "=== ХІД ПРОТИВНИКА #" << game.getTurnNumber() << " ===\n" << Color::RESET;
+            std::cout << "Очікування пострілу від сервера...\n";
+        }
+    }
+    
+    void onInvalidShot(const GameEngine&, int seat, const Coordinate&) override {
+        if (seat == localSeat) {
+            displayShotResult(SHOT_INVALID);
+        }
+    }
+    
+    void onShot(const GameEngine& game, int seat, const Coordinate& target, ShotResult result) override {
+        const Player& local = game.getPlayer(localSeat);
+        
+        if (seat == localSeat) {
+            displayShotResult(result);
+            local.displayTrackingBoard();
+        } else {
+            std::cout << "Противник стріляє по " << char('A' + target.row) << target.col << "\n";
+            local.displayOwnBoard();
+        }
+        
+        if (result != SHOT_WIN) {
+            pause();
+        }
+    }
+    
+    void onGameOver(const GameEngine& game, int winner) override {
+        displayVictory(game.getPlayer(winner).getName());
+    }
+    
+    void onGameAborted(const GameEngine&, int) override {
+        std::cout << Color::RED << "З'єднання втрачено\n" << Color::RESET;
+    }
+};
+
 void playNetworkGameAsClient() {
     GameClient client;
     
@@ -160,88 +219,18 @@ void playNetworkGameAsClient() {
     std::cout << Color::GREEN << "Обидва гравці готові! Починаємо гру...\n" << Color::RESET;
     pause();
     
+    // Клієнт ходить другим
+    RemotePlayer opponent("Противник", netPlayer);
+    GameEngine game(opponent, human);
+    ClientConsoleView view(1);
+    game.addObserver(view);
+    
     // Розміщуємо кораблі
     clearScreen();
-    human.placeShips();
-    
-    std::cout << Color::YELLOW << "\nОчікування початку гри...\n" << Color::RESET;
+    game.placeShips();
     
     // Основний ігровий цикл
-    bool gameOver = false;
-    bool myTurn = false; // Клієнт ходить другим
-    int turnNumber = 1;
-    
-    while (!gameOver && client.isConnected()) {
-        clearScreen();
-        
-        if (myTurn) {
-            // Наш хід
-            std::cout << Color::CYAN << "=== ВАШ ХІД #" << turnNumber << " ===\n" << Color::RESET;
-            human.displayBothBoards();
-            
-            Coordinate target = human.chooseTarget();
-            
-            // Відправляємо постріл
-            if (!netPlayer.sendShot(target)) {
-                std::cout << Color::RED << "Помилка відправки пострілу\n" << Color::RESET;
-                break;
-            }
-            
-            // Отримуємо результат
-            ShotResult result;
-            if (!netPlayer.receiveResult(result)) {
-                std::cout << Color::RED << "Помилка отримання результату\n" << Color::RESET;
-                break;
-            }
-            
-            human.processShotResult(target, result);
-            human.displayTrackingBoard();
-            
-            if (result == SHOT_WIN) {
-                gameOver = true;
-                displayVictory(human.getName());
-            } else {
-                pause();
-                myTurn = false;
-                turnNumber++;
-            }
-            
-        } else {
-            // Хід противника
-            std::cout << Color::YELLOW << "=== ХІД ПРОТИВНИКА #" << turnNumber << " ===\n" << Color::RESET;
-            std::cout << "Очікування пострілу від сервера...\n";
-            
-            Coordinate target;
-            if (!netPlayer.receiveShot(target)) {
-                std::cout << Color::RED << "Помилка отримання пострілу\n" << Color::RESET;
-                break;
-            }
-            
-            std::cout << "Противник стріляє по " << char('A' + target.row) << target.col << "\n";
-            
-            ShotResult result = human.receiveShot(target);
-            
-            // Відправляємо результат
-            if (!netPlayer.sendResult(result)) {
-                std::cout << Color::RED << "Помилка відправки результату\n" << Color::RESET;
-                break;
-            }
-            
-            human.displayOwnBoard();
-            
-            if (result == SHOT_WIN) {
-                gameOver = true;
-                displayVictory("Противник");
-            } else {
-                pause();
-                myTurn = true;
-            }
-        }
-    }
-    
-    if (!client.isConnected()) {
-        std::cout << Color::RED << "З'єднання втрачено\n" << Color::RESET;
-    }
+    game.play();
     
     pause();
     client.disconnect();
@@ -1,6 +1,8 @@
 #ifndef COMMON_H
 #define COMMON_H
 
+#include <algorithm>
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -29,23 +31,97 @@ enum Orientation {
     VERTICAL = 1
 };
 
+// Розміри дошки та склад флоту, задані під час компіляції.
+// Усі похідні величини - константи, тому цикли по дошці та флоту
+// для конкретної геометрії компілятор може повністю розгорнути
+template <int Rows, int Cols, ShipType... Fleet>
+struct BoardGeometry {
+    static_assert(Rows > 0 && Cols > 0, "Board must not be empty");
+    static_assert(sizeof...(Fleet) > 0, "Fleet must not be empty");
+    
+    static constexpr int ROWS = Rows;
+    static constexpr int COLS = Cols;
+    static constexpr int CELLS = Rows * Cols;
+    
+    static constexpr int FLEET_SIZE = sizeof...(Fleet);
+    static constexpr ShipType FLEET[FLEET_SIZE] = {Fleet...};
+    
+    // Найбільший корабель флоту
+    static constexpr int MAX_SHIP_SIZE = std::max({static_cast<int>(Fleet)...});
+};
+
+// Стандартна гра: поле 10x10 та п'ять кораблів
+typedef BoardGeometry<BOARD_SIZE, BOARD_SIZE,
+    CARRIER,      // 1x5
+    BATTLESHIP,   // 1x4
+    CRUISER,      // 1x3
+    SUBMARINE,    // 1x3
+    DESTROYER     // 1x2
+> StandardGeometry;
+
 // Структура для координат
 struct Coordinate {
     int row;
     int col;
     
-    Coordinate() : row(0), col(0) {}
-    Coordinate(int r, int c) : row(r), col(c) {}
+    constexpr Coordinate() : row(0), col(0) {}
+    constexpr Coordinate(int r, int c) : row(r), col(c) {}
     
-    bool isValid() const {
-        return row >= 0 && row < BOARD_SIZE && col >= 0 && col < BOARD_SIZE;
+    // Чи лежить координата на дошці заданої геометрії
+    template <typename Geometry>
+    constexpr bool isValidIn() const {
+        return row >= 0 && row < Geometry::ROWS && col >= 0 && col < Geometry::COLS;
     }
     
-    bool operator==(const Coordinate& other) const {
+    constexpr bool isValid() const {
+        return isValidIn<StandardGeometry>();
+    }
+    
+    constexpr bool operator==(const Coordinate& other) const {
         return row == other.row && col == other.col;
     }
 };
 
+// Діапазон клітинок, які займає корабель (без виділення пам'яті)
+class ShipCells {
+public:
+    class iterator {
+    private:
+        Coordinate start;
+        Orientation orientation;
+        int offset;
+        
+    public:
+        iterator(Coordinate s, Orientation o, int i) : start(s), orientation(o), offset(i) {}
+        
+        Coordinate operator*() const {
+            if (orientation == HORIZONTAL) {
+                return Coordinate(start.row, start.col + offset);
+            }
+            return Coordinate(start.row + offset, start.col);
+        }
+        
+        iterator& operator++() {
+            offset++;
+            return *this;
+        }
+        
+        bool operator!=(const iterator& other) const {
+            return offset != other.offset;
+        }
+    };
+    
+    ShipCells(Coordinate s, Orientation o, int n) : start(s), orientation(o), size(n) {}
+    
+    iterator begin() const { return iterator(start, orientation, 0); }
+    iterator end() const { return iterator(start, orientation, size); }
+    
+private:
+    Coordinate start;
+    Orientation orientation;
+    int size;
+};
+
 // Структура для опису корабля
 struct Ship {
     ShipType type;
@@ -63,15 +139,16 @@ struct Ship {
         return hits >= size;
     }
     
+    // Клітинки корабля для обходу без виділення пам'яті
+    ShipCells cells() const {
+        return ShipCells(start, orientation, size);
+    }
+    
     // Отримати всі координати, які займає корабель
     std::vector<Coordinate> getCoordinates() const {
         std::vector<Coordinate> coords;
-        for (int i = 0; i < size; i++) {
-            if (orientation == HORIZONTAL) {
-                coords.push_back(Coordinate(start.row, start.col + i));
-            } else {
-                coords.push_back(Coordinate(start.row + i, start.col));
-            }
+        for (Coordinate coord : cells()) {
+            coords.push_back(coord);
         }
         return coords;
     }
@@ -98,12 +175,7 @@ namespace Color {
 }
 
 // Стандартна конфігурація флоту
-const std::vector<ShipType> STANDARD_FLEET = {
-    CARRIER,      // 1x5
-    BATTLESHIP,   // 1x4
-    CRUISER,      // 1x3
-    SUBMARINE,    // 1x3
-    DESTROYER     // 1x2
-};
+const std::vector<ShipType> STANDARD_FLEET(std::begin(StandardGeometry::FLEET),
+                                           std::end(StandardGeometry::FLEET));
 
 #endif // COMMON_H
\ No newline at end of file
@@ -0,0 +1,334 @@
+#include "density_kernel.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define DENSITY_X86 1
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+#endif
+
+#if defined(DENSITY_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define DENSITY_HAVE_SSE2 1
+#endif
+
+#if defined(DENSITY_X86) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+    #define DENSITY_HAVE_AVX2 1
+#endif
+
+// GCC та Clang компілюють AVX2-функції без -mavx2 через атрибут target;
+// MSVC дозволяє AVX2-інтринсики без окремих прапорців
+#if defined(__GNUC__) || defined(__clang__)
+    #define DENSITY_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define DENSITY_TARGET_AVX2
+#endif
+
+namespace {
+    using DensityKernel::MAX_ROWS;
+    using DensityKernel::PLANES;
+
+    // Порожні рядки перед і після дошки, щоб зсунуті завантаження не виходили за буфер
+    const int PAD = 16;
+
+    typedef uint16_t PlaneRows[MAX_ROWS];
+
+    // ==================== Скалярна версія ====================
+
+    // Додати маску до лічильників рядка, починаючи з розряду firstPlane
+    inline void addScalar(PlaneRows* planes, int planeCount, int row, uint16_t mask, int firstPlane) {
+        uint16_t carry = mask;
+        for (int j = firstPlane; j < planeCount && carry; j++) {
+            uint16_t next = planes[j][row] & carry;
+            planes[j][row] ^= carry;
+            carry = next;
+        }
+    }
+
+    void countScalar(const uint16_t* freeRows, const int* shipCounts, int maxShipSize,
+                     int planeCount, PlaneRows* planes) {
+        uint16_t verticalStarts[PAD + MAX_ROWS] = {};
+
+        for (int k = 1; k <= maxShipSize; k++) {
+            int count = shipCounts[k];
+            if (count == 0) continue;
+
+            // Вертикальний корабель починається в row, якщо рядки row..row+k-1 вільні
+            if (k > 1) {
+                for (int row = 0; row < MAX_ROWS; row++) {
+                    uint16_t starts = 0xFFFF;
+                    for (int i = 0; i < k; i++) starts &= freeRows[row + i];
+                    verticalStarts[PAD + row] = starts;
+                }
+            }
+
+            for (int row = 0; row < MAX_ROWS; row++) {
+                uint16_t starts = freeRows[row];
+                for (int i = 1; i < k; i++) starts &= freeRows[row] >> i;
+
+                // Кратність кораблів додаємо по розрядах її двійкового запису
+                for (int bit = 0; (count >> bit) != 0; bit++) {
+                    if (!((count >> bit) & 1)) continue;
+
+                    for (int i = 0; i < k; i++) {
+                        addScalar(planes, planeCount, row, static_cast<uint16_t>(starts << i), bit);
+                        if (k > 1) {
+                            addScalar(planes, planeCount, row, verticalStarts[PAD + row - i], bit);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+#ifdef DENSITY_HAVE_SSE2
+    // ==================== SSE2: 8 рядків у регістрі ====================
+
+    inline void addSse2(__m128i* planes, int planeCount, __m128i carry, int firstPlane) {
+        for (int j = firstPlane; j < planeCount; j++) {
+            __m128i next = _mm_and_si128(planes[j], carry);
+            planes[j] = _mm_xor_si128(planes[j], carry);
+            carry = next;
+        }
+    }
+
+    void countSse2(const uint16_t* freeRows, const int* shipCounts, int maxShipSize,
+                   int planeCount, PlaneRows* planes) {
+        const int LANES = 8;
+        const int CHUNKS = MAX_ROWS / LANES;
+
+        __m128i acc[CHUNKS][PLANES];
+        for (int c = 0; c < CHUNKS; c++) {
+            for (int j = 0; j < PLANES; j++) acc[c][j] = _mm_setzero_si128();
+        }
+
+        uint16_t verticalStarts[PAD + MAX_ROWS] = {};
+
+        for (int k = 1; k <= maxShipSize; k++) {
+            int count = shipCounts[k];
+            if (count == 0) continue;
+
+            if (k > 1) {
+                for (int c = 0; c < CHUNKS; c++) {
+                    __m128i starts = _mm_set1_epi16(-1);
+                    for (int i = 0; i < k; i++) {
+                        starts = _mm_and_si128(starts, _mm_loadu_si128(
+                            reinterpret_cast<const __m128i*>(freeRows + c * LANES + i)));
+                    }
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(verticalStarts + PAD + c * LANES), starts);
+                }
+            }
+
+            for (int c = 0; c < CHUNKS; c++) {
+                __m128i rowsFree = _mm_loadu_si128(reinterpret_cast<const __m128i*>(freeRows + c * LANES));
+                __m128i starts = rowsFree;
+                for (int i = 1; i < k; i++) {
+                    starts = _mm_and_si128(starts, _mm_srl_epi16(rowsFree, _mm_cvtsi32_si128(i)));
+                }
+
+                for (int bit = 0; (count >> bit) != 0; bit++) {
+                    if (!((count >> bit) & 1)) continue;
+
+                    for (int i = 0; i < k; i++) {
+                        addSse2(acc[c], planeCount, _mm_sll_epi16(starts, _mm_cvtsi32_si128(i)), bit);
+                        if (k > 1) {
+                            addSse2(acc[c], planeCount, _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                                verticalStarts + PAD + c * LANES - i)), bit);
+                        }
+                    }
+                }
+            }
+        }
+
+        for (int c = 0; c < CHUNKS; c++) {
+            for (int j = 0; j < PLANES; j++) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[j] + c * LANES), acc[c][j]);
+            }
+        }
+    }
+#endif
+
+#ifdef DENSITY_HAVE_AVX2
+    // ==================== AVX2: усі 16 рядків у регістрі ====================
+
+    DENSITY_TARGET_AVX2
+    inline void addAvx2(__m256i* planes, int planeCount, __m256i carry, int firstPlane) {
+        for (int j = firstPlane; j < planeCount; j++) {
+            __m256i next = _mm256_and_si256(planes[j], carry);
+            planes[j] = _mm256_xor_si256(planes[j], carry);
+            carry = next;
+        }
+    }
+
+    DENSITY_TARGET_AVX2
+    void countAvx2(const uint16_t* freeRows, const int* shipCounts, int maxShipSize,
+                   int planeCount, PlaneRows* planes) {
+        __m256i acc[PLANES];
+        for (int j = 0; j < PLANES; j++) acc[j] = _mm256_setzero_si256();
+
+        uint16_t verticalStarts[PAD + MAX_ROWS] = {};
+        __m256i rowsFree = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(freeRows));
+
+        for (int k = 1; k <= maxShipSize; k++) {
+            int count = shipCounts[k];
+            if (count == 0) continue;
+
+            if (k > 1) {
+                __m256i starts = rowsFree;
+                for (int i = 1; i < k; i++) {
+                    starts = _mm256_and_si256(starts, _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(freeRows + i)));
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(verticalStarts + PAD), starts);
+            }
+
+            __m256i starts = rowsFree;
+            for (int i = 1; i < k; i++) {
+                starts = _mm256_and_si256(starts, _mm256_srl_epi16(rowsFree, _mm_cvtsi32_si128(i)));
+            }
+
+            for (int bit = 0; (count >> bit) != 0; bit++) {
+                if (!((count >> bit) & 1)) continue;
+
+                for (int i = 0; i < k; i++) {
+                    addAvx2(acc, planeCount, _mm256_sll_epi16(starts, _mm_cvtsi32_si128(i)), bit);
+                    if (k > 1) {
+                        addAvx2(acc, planeCount, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                            verticalStarts + PAD - i)), bit);
+                    }
+                }
+            }
+        }
+
+        for (int j = 0; j < PLANES; j++) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(planes[j]), acc[j]);
+        }
+    }
+#endif
+
+    typedef void (*CountFunction)(const uint16_t*, const int*, int, int, PlaneRows*);
+
+    CountFunction functionFor(DensityKernel::Isa isa) {
+        switch (isa) {
+#ifdef DENSITY_HAVE_AVX2
+            case DensityKernel::ISA_AVX2:
+                return countAvx2;
+#endif
+#ifdef DENSITY_HAVE_SSE2
+            case DensityKernel::ISA_SSE2:
+                return countSse2;
+#endif
+            default:
+                return countScalar;
+        }
+    }
+
+    // Номер найменшого встановленого біта (mask != 0)
+    inline int lowestBit(unsigned mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(mask);
+#else
+        int index = 0;
+        while (!(mask & 1)) {
+            mask >>= 1;
+            index++;
+        }
+        return index;
+#endif
+    }
+}
+
+namespace DensityKernel {
+    Isa detectIsa() {
+#if defined(DENSITY_HAVE_AVX2) && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return ISA_AVX2;
+        }
+#elif defined(DENSITY_HAVE_AVX2) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] >= 7) {
+            __cpuid(info, 1);
+            bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6;
+
+            __cpuidex(info, 7, 0);
+            if (osSavesYmm && (info[1] & (1 << 5))) {
+                return ISA_AVX2;
+            }
+        }
+#endif
+
+#ifdef DENSITY_HAVE_SSE2
+        return ISA_SSE2;
+#else
+        return ISA_SCALAR;
+#endif
+    }
+
+    const char* isaName(Isa isa) {
+        switch (isa) {
+            case ISA_AVX2: return "avx2";
+            case ISA_SSE2: return "sse2";
+            default: return "scalar";
+        }
+    }
+
+    bool countPlacements(const uint16_t* freeRows, int rows, int cols,
+                         const int* shipCounts, int maxShipSize, int* density) {
+        // Набір інструкцій визначається один раз
+        static const Isa isa = detectIsa();
+        return countPlacements(isa, freeRows, rows, cols, shipCounts, maxShipSize, density);
+    }
+
+    bool countPlacements(Isa isa, const uint16_t* freeRows, int rows, int cols,
+                         const int* shipCounts, int maxShipSize, int* density) {
+        if (rows < 1 || rows > MAX_ROWS || cols < 1 || cols > MAX_COLS ||
+            maxShipSize < 1 || maxShipSize > PAD) {
+            return false;
+        }
+
+        // Кожна клітинка покрита не більше ніж 2k позиціями корабля довжини k
+        int maxCount = 0;
+        for (int k = 1; k <= maxShipSize; k++) {
+            maxCount += shipCounts[k] * 2 * k;
+        }
+        if (maxCount > MAX_COUNT) {
+            return false;
+        }
+        
+        // Старші розряди, які лічильник не може зачепити, не обробляємо
+        int planeCount = 1;
+        while ((maxCount >> planeCount) != 0) {
+            planeCount++;
+        }
+
+        // Рядки дошки з порожніми рядками навколо
+        uint16_t buffer[PAD + MAX_ROWS + PAD] = {};
+        uint16_t colMask = static_cast<uint16_t>((1u << cols) - 1);
+        for (int row = 0; row < rows; row++) {
+            buffer[PAD + row] = freeRows[row] & colMask;
+        }
+
+        PlaneRows planes[PLANES];
+        std::memset(planes, 0, sizeof(planes));
+        functionFor(isa)(buffer + PAD, shipCounts, maxShipSize, planeCount, planes);
+
+        // Переводимо порозрядні лічильники в числа
+        for (int i = 0; i < rows * cols; i++) {
+            density[i] = 0;
+        }
+        for (int j = 0; j < planeCount; j++) {
+            for (int row = 0; row < rows; row++) {
+                unsigned bits = planes[j][row];
+                while (bits) {
+                    int col = lowestBit(bits);
+                    density[row * cols + col] += 1 << j;
+                    bits &= bits - 1;
+                }
+            }
+        }
+        return true;
+    }
+}
\ No newline at end of file
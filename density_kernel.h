@@ -0,0 +1,51 @@
+#ifndef DENSITY_KERNEL_H
+#define DENSITY_KERNEL_H
+
+#include <cstdint>
+
+// Підрахунок кількості позицій кораблів через кожну клітинку дошки.
+//
+// Дошка подається масками вільних клітинок по рядках (біт col рядка row).
+// Початки горизонтальних позицій корабля довжини k - AND маски рядка з її
+// зсувами на 1..k-1 біт, вертикальних - AND k сусідніх рядків. Лічильники
+// клітинок зберігаються порозрядно (bit-sliced): площина j містить j-й біт
+// лічильника кожної клітинки, тож додавання маски до всіх лічильників - це
+// кілька AND/XOR над цілими рядками. На AVX2 усі 16 рядків обробляються
+// одним регістром, на SSE2 - двома, скалярна версія йде рядок за рядком.
+// Ядро рахує густину для режиму пошуку SmartAI (setDensityHunt), де всі позиції рівноважні.
+namespace DensityKernel {
+    // Найбільші розміри дошки, які вміщує один 16-бітний рядок
+    const int MAX_ROWS = 16;
+    const int MAX_COLS = 16;
+
+    // Кількість розрядів лічильника; сума кількостей кораблів, помножених
+    // на 2k, не повинна перевищувати MAX_COUNT
+    const int PLANES = 10;
+    const int MAX_COUNT = (1 << PLANES) - 1;
+
+    enum Isa {
+        ISA_SCALAR = 0,
+        ISA_SSE2 = 1,
+        ISA_AVX2 = 2
+    };
+
+    // Найкращий набір інструкцій, який підтримує процесор
+    Isa detectIsa();
+
+    // Назва набору інструкцій (для бенчмарків та логів)
+    const char* isaName(Isa isa);
+
+    // Порахувати позиції через кожну клітинку.
+    //   freeRows[row]   - маска клітинок рядка, де може стояти корабель
+    //   shipCounts[k]   - кількість кораблів довжини k, k = 1..maxShipSize
+    //   density         - результат, rows * cols значень (row * cols + col)
+    // Повертає false, якщо розміри не підтримуються або лічильник може переповнитись
+    bool countPlacements(const uint16_t* freeRows, int rows, int cols,
+                         const int* shipCounts, int maxShipSize, int* density);
+
+    // Те саме з явним вибором набору інструкцій (для перевірки та бенчмарків)
+    bool countPlacements(Isa isa, const uint16_t* freeRows, int rows, int cols,
+                         const int* shipCounts, int maxShipSize, int* density);
+}
+
+#endif // DENSITY_KERNEL_H
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "density_map.h"
+#include <algorithm>
+
+// ==================== DensityMap ====================
+
+DensityMap::DensityMap() {
+    reset();
+}
+
+const DensityMap::CellIndex& DensityMap::cellIndex() {
+    // Списки будуються один раз при першому зверненні
+    static const CellIndex index = [] {
+        CellIndex result;
+        std::vector<std::vector<uint16_t>> footprint(Board::CELLS);
+        std::vector<std::vector<uint16_t>> ring(Board::CELLS);
+
+        for (int p = 0; p < PLACEMENTS; p++) {
+            const Board::Placement& placement = PlacementTable::ENTRIES<StandardGeometry>[p];
+            for (int cell = 0; cell < Board::CELLS; cell++) {
+                if (placement.footprint.test(cell)) {
+                    footprint[cell].push_back(static_cast<uint16_t>(p));
+                } else if (placement.halo.test(cell)) {
+                    ring[cell].push_back(static_cast<uint16_t>(p));
+                }
+            }
+        }
+
+        for (int cell = 0; cell < Board::CELLS; cell++) {
+            result.footprintBegin.push_back(static_cast<uint32_t>(result.footprint.size()));
+            result.footprint.insert(result.footprint.end(), footprint[cell].begin(), footprint[cell].end());
+            result.ringBegin.push_back(static_cast<uint32_t>(result.ring.size()));
+            result.ring.insert(result.ring.end(), ring[cell].begin(), ring[cell].end());
+        }
+        result.footprintBegin.push_back(static_cast<uint32_t>(result.footprint.size()));
+        result.ringBegin.push_back(static_cast<uint32_t>(result.ring.size()));
+        return result;
+    }();
+    return index;
+}
+
+void DensityMap::reset() {
+    // Позиції розмірів, яких немає у флоті, одразу неможливі
+    std::array<bool, StandardGeometry::MAX_SHIP_SIZE + 1> inFleet{};
+    for (ShipType type : StandardGeometry::FLEET) {
+        inFleet[static_cast<int>(type)] = true;
+    }
+
+    for (Density& density : sizeDensity) {
+        density.fill(0);
+    }
+    coveredHits.fill(0);
+
+    for (int p = 0; p < PLACEMENTS; p++) {
+        alive[p] = inFleet[PlacementTable::ENTRIES<StandardGeometry>[p].size];
+        if (alive[p]) {
+            addPlacement(p, 1);
+        }
+    }
+
+    // Хеш порожньої дошки
+    syncedHash = 0;
+}
+
+void DensityMap::addPlacement(int placement, int sign) {
+    const Board::Placement& p = PlacementTable::ENTRIES<StandardGeometry>[placement];
+    Density& density = sizeDensity[p.size];
+    int weight = sign * weightOf(coveredHits[placement]);
+
+    int cell = Board::cellIndex(p.start);
+    int step = p.orientation == HORIZONTAL ? 1 : Board::COLS;
+    for (int i = 0; i < p.size; i++, cell += step) {
+        density[cell] += weight;
+    }
+}
+
+void DensityMap::killPlacement(int placement) {
+    if (!alive[placement]) return;
+
+    addPlacement(placement, -1);
+    alive[placement] = false;
+}
+
+void DensityMap::onMiss(int cell) {
+    // Позиції через промах неможливі
+    const CellIndex& index = cellIndex();
+    for (uint32_t i = index.footprintBegin[cell]; i < index.footprintBegin[cell + 1]; i++) {
+        killPlacement(index.footprint[i]);
+    }
+}
+
+void DensityMap::onHit(int cell) {
+    const CellIndex& index = cellIndex();
+
+    // Позиції через влучання стають вагомішими
+    for (uint32_t i = index.footprintBegin[cell]; i < index.footprintBegin[cell + 1]; i++) {
+        int p = index.footprint[i];
+        if (!alive[p]) continue;
+
+        addPlacement(p, -1);
+        coveredHits[p]++;
+        addPlacement(p, 1);
+    }
+
+    // Корабель не може торкатися влучання, яке йому не належить
+    for (uint32_t i = index.ringBegin[cell]; i < index.ringBegin[cell + 1]; i++) {
+        killPlacement(index.ring[i]);
+    }
+}
+
+void DensityMap::onSunk(const Ship& ship) {
+    // Потоплений корабель та клітинки навколо нього зайняті
+    const CellIndex& index = cellIndex();
+    int lastRow = ship.orientation == VERTICAL ? ship.start.row + ship.size - 1 : ship.start.row;
+    int lastCol = ship.orientation == HORIZONTAL ? ship.start.col + ship.size - 1 : ship.start.col;
+
+    for (int row = std::max(0, ship.start.row - 1); row <= std::min(Board::ROWS - 1, lastRow + 1); row++) {
+        for (int col = std::max(0, ship.start.col - 1); col <= std::min(Board::COLS - 1, lastCol + 1); col++) {
+            int cell = Board::cellIndex(Coordinate(row, col));
+            for (uint32_t i = index.footprintBegin[cell]; i < index.footprintBegin[cell + 1]; i++) {
+                killPlacement(index.footprint[i]);
+            }
+        }
+    }
+}
+
+void DensityMap::rebuild(const Board& tracking) {
+    reset();
+
+    Board::Mask openHits = tracking.getHitMask().without(tracking.getSunkMask());
+    for (int cell = 0; cell < Board::CELLS; cell++) {
+        if (tracking.getMissMask().test(cell)) {
+            onMiss(cell);
+        } else if (openHits.test(cell)) {
+            onHit(cell);
+        }
+    }
+
+    // На tracking board лежать лише потоплені кораблі
+    for (const Ship& ship : tracking.getShips()) {
+        onSunk(ship);
+    }
+
+    syncedHash = tracking.getHash();
+}
+
+void DensityMap::update(const Board& tracking, const Coordinate& coord, ShotResult result) {
+    int cell = Board::cellIndex(coord);
+
+    switch (result) {
+        case SHOT_MISS:
+            onMiss(cell);
+            break;
+
+        case SHOT_HIT:
+            onHit(cell);
+            break;
+
+        case SHOT_SUNK:
+        case SHOT_WIN:
+            onHit(cell);
+            if (!tracking.getShips().empty()) {
+                onSunk(tracking.getShips().back());
+            }
+            break;
+
+        case SHOT_INVALID:
+            return;
+    }
+
+    syncedHash = tracking.getHash();
+}
+
+void DensityMap::combine(const ShipCounts& counts, Density& density) const {
+    density.fill(0);
+    for (int size = 1; size <= StandardGeometry::MAX_SHIP_SIZE; size++) {
+        if (counts[size] == 0) continue;
+
+        for (int cell = 0; cell < Board::CELLS; cell++) {
+            density[cell] += counts[size] * sizeDensity[size][cell];
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef DENSITY_MAP_H
+#define DENSITY_MAP_H
+
+#include "common.h"
+#include "board.h"
+#include "placement_table.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Карта густини позицій кораблів, яка оновлюється після кожного пострілу.
+//
+// Для кожної позиції з таблиці PlacementTable зберігається, чи вона ще можлива,
+// і скільки незакритих влучань вона покриває. Вага позиції додана до клітинок
+// її корабля окремо для кожного розміру, тому постріл змінює лише позиції,
+// які проходять через клітинку або торкаються її, а кількість кораблів
+// кожного розміру враховується лише при зведенні карти (combine).
+class DensityMap {
+public:
+    typedef std::array<int, StandardGeometry::MAX_SHIP_SIZE + 1> ShipCounts;
+    typedef std::array<int, Board::CELLS> Density;
+
+    static const int PLACEMENTS = PlacementTable::TOTAL<StandardGeometry>;
+
+private:
+    // Стан кожної позиції
+    std::array<bool, PLACEMENTS> alive;
+    std::array<uint8_t, PLACEMENTS> coveredHits;
+
+    // Сума ваг можливих позицій через клітинку, окремо для кожного розміру
+    std::array<Density, StandardGeometry::MAX_SHIP_SIZE + 1> sizeDensity;
+
+    // Хеш tracking board, для якого карта актуальна
+    uint64_t syncedHash;
+
+    // Додати (sign = 1) або відняти (sign = -1) вагу позиції з клітинок
+    void addPlacement(int placement, int sign);
+    void killPlacement(int placement);
+
+    void onMiss(int cell);
+    void onHit(int cell);
+    void onSunk(const Ship& ship);
+
+public:
+    // Списки позицій для кожної клітинки (спільні для всіх карт):
+    // позиції, що проходять через клітинку, та позиції, що лише торкаються її
+    struct CellIndex {
+        std::vector<uint32_t> footprintBegin;
+        std::vector<uint16_t> footprint;
+        std::vector<uint32_t> ringBegin;
+        std::vector<uint16_t> ring;
+    };
+    static const CellIndex& cellIndex();
+
+    DensityMap();
+
+    // Вага позиції залежно від кількості незакритих влучань, які вона покриває:
+    // позиції через влучання набагато ймовірніші за решту
+    static int weightOf(int hits) { return 1 << (4 * hits); }
+
+    // Усі позиції кораблів флоту можливі (порожня tracking board)
+    void reset();
+
+    // Перебудувати карту за поточним станом tracking board
+    void rebuild(const Board& tracking);
+
+    // Врахувати результат пострілу, вже записаний у tracking board
+    void update(const Board& tracking, const Coordinate& coord, ShotResult result);
+
+    // Чи відповідає карта стану tracking board
+    bool isSyncedWith(const Board& tracking) const { return syncedHash == tracking.getHash(); }
+
+    // Зведена густина з урахуванням кількості непотоплених кораблів кожного розміру
+    void combine(const ShipCounts& counts, Density& density) const;
+};
+
+#endif // DENSITY_MAP_H
\ No newline at end of file
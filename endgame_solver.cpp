@@ -0,0 +1,311 @@
+#include "endgame_solver.h"
+#include "placement_table.h"
+#include "zobrist.h"
+#include <algorithm>
+#include <limits>
+
+// ==================== EndgameSolver ====================
+
+namespace {
+    // Ліміт кроків перебору розстановок
+    const size_t MAX_ENUMERATION_STEPS = 1 << 20;
+
+    const double EPSILON = 1e-9;
+
+    enum Outcome {
+        OUTCOME_MISS = 0,
+        OUTCOME_HIT = 1,
+        OUTCOME_SUNK = 2,
+        OUTCOMES = 3
+    };
+
+    const Board::Placement& placementAt(int index) {
+        return PlacementTable::ENTRIES<StandardGeometry>[index];
+    }
+}
+
+EndgameSolver::EndgameSolver(int maxLayouts, size_t maxNodes)
+    : maxLayouts(maxLayouts), maxNodes(maxNodes), nodes(0), aborted(false) {
+}
+
+bool EndgameSolver::enumerate(const Board& tracking, const ShipCounts& remaining) {
+    layouts.clear();
+
+    // Кораблі від більших до менших
+    int sizes[StandardGeometry::FLEET_SIZE];
+    int shipCount = 0;
+    for (int size = StandardGeometry::MAX_SHIP_SIZE; size >= 1; size--) {
+        for (int i = 0; i < remaining[size]; i++) {
+            sizes[shipCount++] = size;
+        }
+    }
+
+    const Board::Mask blocked = tracking.getNoShipMask();
+    const Board::Mask openHits = tracking.getHitMask().without(tracking.getSunkMask());
+    const Board::Placement* entries = PlacementTable::ENTRIES<StandardGeometry>.data();
+
+    const DensityMap::CellIndex& index = DensityMap::cellIndex();
+
+    Layout current;
+    current.shipCount = shipCount;
+    bool used[StandardGeometry::FLEET_SIZE] = {};
+    size_t steps = 0;
+    bool overflow = false;
+
+    auto nextFree = [&](int k) {
+        while (k < shipCount && used[k]) k++;
+        return k;
+    };
+
+    // 2. Решта кораблів у вільних клітинках подалі від влучань. Корабель k
+    //    ставимо на позицію не раніше from (для однакових розмірів - лише після
+    //    попереднього, щоб не рахувати ту саму розстановку двічі)
+    auto placeFree = [&](auto& self, int placed, int k, const Board::Placement* from,
+                         const Board::Mask& occupied, const Board::Mask& cells) -> void {
+        if (overflow) return;
+        if (++steps > MAX_ENUMERATION_STEPS) {
+            overflow = true;
+            return;
+        }
+
+        if (k == shipCount) {
+            if (static_cast<int>(layouts.size()) == maxLayouts) {
+                overflow = true;
+                return;
+            }
+            current.cells = cells;
+            layouts.push_back(current);
+            return;
+        }
+
+        int next = nextFree(k + 1);
+        const Board::Placement* last = PlacementTable::end<StandardGeometry>(sizes[k]);
+        for (const Board::Placement* p = from; p != last; ++p) {
+            if (p->footprint.intersects(occupied) || p->halo.intersects(openHits)) continue;
+
+            current.ships[placed] = static_cast<uint16_t>(p - entries);
+            const Board::Placement* nextFrom = next == shipCount ? nullptr
+                : sizes[next] == sizes[k] ? p + 1 : PlacementTable::begin<StandardGeometry>(sizes[next]);
+            self(self, placed + 1, next, nextFrom, occupied | p->halo, cells | p->footprint);
+            if (overflow) return;
+        }
+    };
+
+    // 1. Кожне влучання належить якомусь кораблю: перше незакрите влучання
+    //    закриваємо кожною можливою позицією ще не поставленого корабля
+    auto coverHits = [&](auto& self, int placed, const Board::Mask& occupied,
+                         const Board::Mask& cells) -> void {
+        if (overflow) return;
+        if (++steps > MAX_ENUMERATION_STEPS) {
+            overflow = true;
+            return;
+        }
+
+        Board::Mask uncovered = openHits.without(cells);
+        if (uncovered.none()) {
+            int k = nextFree(0);
+            placeFree(placeFree, placed, k,
+                      k == shipCount ? nullptr : PlacementTable::begin<StandardGeometry>(sizes[k]),
+                      occupied, cells);
+            return;
+        }
+
+        int cell = uncovered.lowest();
+        for (uint32_t i = index.footprintBegin[cell]; i < index.footprintBegin[cell + 1]; i++) {
+            const Board::Placement& p = entries[index.footprint[i]];
+            if (p.footprint.intersects(occupied)) continue;
+            // Корабель не торкається чужих влучань і не складається лише з влучань
+            if (p.halo.without(p.footprint).intersects(openHits)) continue;
+            if (p.footprint.without(openHits).none()) continue;
+
+            // Однакові кораблі взаємозамінні - беремо перший вільний
+            int k = 0;
+            while (k < shipCount && (used[k] || sizes[k] != p.size)) k++;
+            if (k == shipCount) continue;
+
+            used[k] = true;
+            current.ships[placed] = index.footprint[i];
+            self(self, placed + 1, occupied | p.halo, cells | p.footprint);
+            used[k] = false;
+            if (overflow) return;
+        }
+    };
+
+    coverHits(coverHits, 0, blocked, Board::Mask());
+    return !overflow;
+}
+
+uint64_t EndgameSolver::positionKey(const std::vector<uint16_t>& subset, const Board::Mask& attacked,
+                                    const Board::Mask& anyShip) const {
+    // Результати пострілів по клітинках, де ще можуть бути кораблі: влучання
+    // чи промах однакові для всіх розстановок гілки
+    uint64_t key = 0;
+    const Board::Mask& cells = layouts[subset[0]].cells;
+    (anyShip & attacked).forEachSet([&](int cell) {
+        key ^= cells.test(cell) ? Zobrist::KEYS<Board::CELLS>.hit[cell] : Zobrist::KEYS<Board::CELLS>.miss[cell];
+    });
+
+    // Промахи поза цими клітинками на решту гри не впливають, а от набір
+    // розстановок може відрізнятися - додаємо і його
+    for (uint16_t index : subset) {
+        uint64_t state = index;
+        key ^= Zobrist::splitMix64(state);
+    }
+    return key;
+}
+
+double EndgameSolver::search(const std::vector<uint16_t>& subset, const Board::Mask& attacked,
+                             int cellsLeft, int& bestCell) {
+    bestCell = -1;
+    if (cellsLeft == 0) return 0.0;
+
+    // Розстановка відома - залишилось добити її клітинки
+    if (subset.size() == 1) {
+        bestCell = layouts[subset[0]].cells.without(attacked).lowest();
+        return cellsLeft;
+    }
+
+    Board::Mask anyShip;
+    Board::Mask everyShip = layouts[subset[0]].cells;
+    for (uint16_t index : subset) {
+        anyShip |= layouts[index].cells;
+        everyShip &= layouts[index].cells;
+    }
+
+    uint64_t key = positionKey(subset, attacked, anyShip);
+    auto found = table.find(key);
+    if (found != table.end()) {
+        bestCell = found->second.bestCell;
+        return found->second.expectedShots;
+    }
+
+    if (++nodes > maxNodes) {
+        aborted = true;
+        return 0.0;
+    }
+
+    anyShip = anyShip.without(attacked);
+    everyShip = everyShip.without(attacked);
+
+    // Клітинку, де корабель є в кожній розстановці, однаково треба підбити;
+    // постріл по ній зараз лише раніше дає інформацію. Клітинки поза всіма
+    // розстановками - гарантований промах, їх не розглядаємо
+    Board::Mask candidates = anyShip;
+    if (everyShip.any()) {
+        candidates.clear();
+        candidates.set(everyShip.lowest());
+    }
+
+    const double total = static_cast<double>(subset.size());
+    double bestValue = std::numeric_limits<double>::infinity();
+    std::vector<uint16_t> outcomes[OUTCOMES];
+
+    // Спершу клітинки, де корабель трапляється найчастіше: вони зазвичай
+    // найкращі, і отримана оцінка відсікає більшість інших
+    std::vector<std::pair<int, int>> order;
+    candidates.forEachSet([&](int cell) {
+        int count = 0;
+        for (uint16_t index : subset) {
+            count += layouts[index].cells.test(cell);
+        }
+        order.push_back(std::make_pair(-count, cell));
+    });
+    std::sort(order.begin(), order.end());
+
+    for (const std::pair<int, int>& candidate : order) {
+        int cell = candidate.second;
+
+        for (std::vector<uint16_t>& bucket : outcomes) {
+            bucket.clear();
+        }
+
+        Board::Mask afterShot = attacked;
+        afterShot.set(cell);
+
+        for (uint16_t index : subset) {
+            const Layout& layout = layouts[index];
+            if (!layout.cells.test(cell)) {
+                outcomes[OUTCOME_MISS].push_back(index);
+                continue;
+            }
+
+            for (int s = 0; s < layout.shipCount; s++) {
+                const Board::Placement& ship = placementAt(layout.ships[s]);
+                if (!ship.footprint.test(cell)) continue;
+
+                bool sunk = ship.footprint.without(afterShot).none();
+                outcomes[sunk ? OUTCOME_SUNK : OUTCOME_HIT].push_back(index);
+                break;
+            }
+        }
+
+        // Нижня оцінка: кожна гілка потребує щонайменше стільки пострілів,
+        // скільки в ній непідбитих клітинок
+        size_t hits = outcomes[OUTCOME_HIT].size() + outcomes[OUTCOME_SUNK].size();
+        double bound = 1.0 + (outcomes[OUTCOME_MISS].size() * cellsLeft + hits * (cellsLeft - 1)) / total;
+        if (bound >= bestValue - EPSILON) continue;
+
+        // Оцінку гілок по черзі замінюємо точним значенням
+        double value = bound;
+        for (int outcome = 0; outcome < OUTCOMES; outcome++) {
+            if (outcomes[outcome].empty()) continue;
+
+            int childBest;
+            int childCells = outcome == OUTCOME_MISS ? cellsLeft : cellsLeft - 1;
+            double childValue = search(outcomes[outcome], afterShot, childCells, childBest);
+            if (aborted) return 0.0;
+
+            value += outcomes[outcome].size() / total * (childValue - childCells);
+            if (value >= bestValue - EPSILON) break;
+        }
+
+        if (value < bestValue - EPSILON) {
+            bestValue = value;
+            bestCell = cell;
+        }
+    }
+
+    table[key] = Entry{bestValue, bestCell};
+    return bestValue;
+}
+
+EndgameSolver::Result EndgameSolver::solve(const Board& tracking, const ShipCounts& remaining) {
+    Result result;
+    result.solved = false;
+    result.target = Coordinate(-1, -1);
+    result.expectedShots = 0.0;
+
+    // Розв'язувач вимкнено - навіть не перебираємо розстановки
+    if (maxLayouts <= 0 || !enumerate(tracking, remaining)) {
+        result.layouts = maxLayouts + 1;
+        return result;
+    }
+    result.layouts = static_cast<int>(layouts.size());
+    if (layouts.empty()) {
+        return result;
+    }
+
+    std::vector<uint16_t> subset(layouts.size());
+    for (size_t i = 0; i < subset.size(); i++) {
+        subset[i] = static_cast<uint16_t>(i);
+    }
+
+    // Непідбиті клітинки кораблів - однакові для всіх розстановок
+    int cellsLeft = layouts[0].cells.without(tracking.getHitMask()).count();
+
+    // Ключі позицій залежать від номерів розстановок, тому таблиця - лише на один розв'язок
+    table.clear();
+    nodes = 0;
+    aborted = false;
+    int bestCell;
+    double expected = search(subset, tracking.getAttackedMask(), cellsLeft, bestCell);
+
+    if (aborted || bestCell < 0) {
+        return result;
+    }
+
+    result.solved = true;
+    result.target = Coordinate(bestCell / Board::COLS, bestCell % Board::COLS);
+    result.expectedShots = expected;
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifndef ENDGAME_SOLVER_H
+#define ENDGAME_SOLVER_H
+
+#include "common.h"
+#include "board.h"
+#include "density_map.h"
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Точний розв'язувач кінця гри.
+//
+// Коли сумісних з tracking board розстановок непотоплених кораблів мало,
+// перебираються всі вони, а потім рекурсивно (expectimax) шукається постріл
+// з найменшим очікуваним числом пострілів до перемоги. Усі розстановки
+// вважаються рівноймовірними. Результати позицій зберігаються в таблиці
+// транспозицій за Zobrist-хешем пострілів tracking board (лише по клітинках,
+// де ще можуть бути кораблі), тому однакові позиції, досягнуті різним
+// порядком пострілів, рахуються один раз.
+class EndgameSolver {
+public:
+    typedef DensityMap::ShipCounts ShipCounts;
+
+    struct Result {
+        bool solved;             // false - розстановок забагато або перевищено ліміт вузлів
+        Coordinate target;       // Найкращий постріл
+        double expectedShots;    // Очікувана кількість пострілів до перемоги
+        int layouts;             // Кількість сумісних розстановок (maxLayouts + 1, якщо більше)
+    };
+
+private:
+    // Одна розстановка непотоплених кораблів
+    struct Layout {
+        Board::Mask cells;
+        std::array<uint16_t, StandardGeometry::FLEET_SIZE> ships;  // Індекси в PlacementTable
+        int shipCount;
+    };
+
+    struct Entry {
+        double expectedShots;
+        int bestCell;
+    };
+
+    int maxLayouts;
+    size_t maxNodes;
+
+    std::vector<Layout> layouts;
+    std::unordered_map<uint64_t, Entry> table;
+    size_t nodes;
+    bool aborted;
+
+    // Перебір розстановок; false, якщо їх більше за maxLayouts
+    bool enumerate(const Board& tracking, const ShipCounts& remaining);
+
+    // Zobrist-ключ позиції для таблиці транспозицій
+    uint64_t positionKey(const std::vector<uint16_t>& subset, const Board::Mask& attacked,
+                         const Board::Mask& anyShip) const;
+
+    // Очікувана кількість пострілів для розстановок subset після пострілів attacked.
+    //   cellsLeft  - кількість ще не підбитих клітинок кораблів
+    double search(const std::vector<uint16_t>& subset, const Board::Mask& attacked,
+                  int cellsLeft, int& bestCell);
+
+public:
+    // Поріг для інтерактивної гри: на ньому AI в середньому робить на 3 постріли
+    // менше, але партія AI проти AI стає в десятки разів довшою
+    static const int RECOMMENDED_MAX_LAYOUTS = 12;
+
+    // maxLayouts - найбільша кількість розстановок, з якою береться розв'язувач
+    // (0 - вимкнено, solve одразу повертає solved = false);
+    // maxNodes - ліміт нових позицій за один виклик solve
+    EndgameSolver(int maxLayouts = 0, size_t maxNodes = 20000);
+
+    void setMaxLayouts(int limit) { maxLayouts = limit; }
+    int getMaxLayouts() const { return maxLayouts; }
+
+    // Знайти найкращий постріл для позиції на tracking board
+    Result solve(const Board& tracking, const ShipCounts& remaining);
+
+};
+
+#endif // ENDGAME_SOLVER_H
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "fleet_sampler.h"
+#include <algorithm>
+#include <unordered_map>
+
+FleetSampler::FleetSampler(int rowCount, int colCount, const std::vector<ShipType>& fleet)
+    : rows(rowCount), cols(colCount), fleetStates(1), fullFleet(0), layoutCount(0) {
+    // Групуємо кораблі за розміром
+    for (ShipType type : fleet) {
+        int size = static_cast<int>(type);
+        auto it = std::find(sizes.begin(), sizes.end(), size);
+        if (it == sizes.end()) {
+            sizes.push_back(size);
+            sizeCounts.push_back(1);
+        } else {
+            sizeCounts[it - sizes.begin()]++;
+        }
+    }
+    
+    for (size_t i = 0; i < sizes.size(); i++) {
+        fleetRadix.push_back(fleetStates);
+        fullFleet += sizeCounts[i] * fleetStates;
+        fleetStates *= sizeCounts[i] + 1;
+    }
+    
+    fleetContains.assign(fleetStates * fleetStates, 1);
+    for (int f = 0; f < fleetStates; f++) {
+        for (int g = 0; g < fleetStates; g++) {
+            for (size_t i = 0; i < sizes.size(); i++) {
+                if (digit(g, static_cast<int>(i)) > digit(f, static_cast<int>(i))) {
+                    fleetContains[f * fleetStates + g] = 0;
+                }
+            }
+        }
+    }
+    
+    // Будуємо граф станів рядок за рядком, починаючи з порожнього рядка над дошкою
+    std::vector<uint32_t> rowBegin;
+    stateProfile.push_back(0);
+    rowBegin.push_back(0);
+    
+    for (int row = 0; row < rows; row++) {
+        uint32_t begin = rowBegin.back();
+        uint32_t end = static_cast<uint32_t>(stateProfile.size());
+        rowBegin.push_back(end);
+        
+        std::unordered_map<uint64_t, uint32_t> nextIndex;
+        for (uint32_t state = begin; state < end; state++) {
+            transitionBegin.push_back(static_cast<uint32_t>(transitions.size()));
+            
+            auto visit = [&](uint64_t next, int used) {
+                auto inserted = nextIndex.emplace(next, static_cast<uint32_t>(stateProfile.size()));
+                if (inserted.second) {
+                    stateProfile.push_back(next);
+                }
+                transitions.push_back(RowTransition{inserted.first->second, static_cast<uint32_t>(used)});
+            };
+            expand(row, stateProfile[state], 0, false, 0, 0, visit);
+        }
+    }
+    
+    // Стани під останнім рядком переходів не мають
+    uint32_t stateCount = static_cast<uint32_t>(stateProfile.size());
+    while (transitionBegin.size() <= stateCount) {
+        transitionBegin.push_back(static_cast<uint32_t>(transitions.size()));
+    }
+    transitions.shrink_to_fit();
+    stateProfile.shrink_to_fit();
+    
+    // Які набори кораблів можуть залишитись у кожному стані
+    std::vector<char> reachable(static_cast<size_t>(stateCount) * fleetStates, 0);
+    reachable[fullFleet] = 1;
+    for (uint32_t state = 0; state < rowBegin[rows]; state++) {
+        for (int f = 0; f < fleetStates; f++) {
+            if (!reachable[static_cast<size_t>(state) * fleetStates + f]) continue;
+            
+            for (uint32_t t = transitionBegin[state]; t < transitionBegin[state + 1]; t++) {
+                const RowTransition& tr = transitions[t];
+                if (fleetContains[f * fleetStates + tr.used]) {
+                    reachable[static_cast<size_t>(tr.next) * fleetStates + f - tr.used] = 1;
+                }
+            }
+        }
+    }
+    
+    // Рахуємо розстановки знизу вгору, зберігаючи лише ненульові кількості.
+    // Під дошкою вертикальні кораблі не продовжуються (expand їх не починає),
+    // тож розстановка завершена, коли не залишилось кораблів
+    countBegin.assign(stateCount, 0);
+    countEnd.assign(stateCount, 0);
+    
+    for (uint32_t state = stateCount; state-- > 0;) {
+        countBegin[state] = static_cast<uint32_t>(countValue.size());
+        
+        for (int f = 0; f < fleetStates; f++) {
+            if (!reachable[static_cast<size_t>(state) * fleetStates + f]) continue;
+            
+            uint64_t total = 0;
+            if (state >= rowBegin[rows]) {
+                total = f == 0 ? 1 : 0;
+            }
+            for (uint32_t t = transitionBegin[state]; t < transitionBegin[state + 1]; t++) {
+                const RowTransition& tr = transitions[t];
+                if (fleetContains[f * fleetStates + tr.used]) {
+                    total += countOf(tr.next, f - tr.used);
+                }
+            }
+            
+            if (total > 0) {
+                countFleet.push_back(static_cast<uint16_t>(f));
+                countValue.push_back(total);
+            }
+        }
+        
+        countEnd[state] = static_cast<uint32_t>(countValue.size());
+    }
+    
+    layoutCount = countOf(0, fullFleet);
+    
+    // Переходи з більшою кількістю продовжень ставимо першими, щоб вибір
+    // у sample() зазвичай зупинявся на початку списку
+    std::vector<std::pair<uint64_t, RowTransition>> weighted;
+    for (uint32_t state = 0; state < rowBegin[rows]; state++) {
+        weighted.clear();
+        for (uint32_t t = transitionBegin[state]; t < transitionBegin[state + 1]; t++) {
+            const RowTransition& tr = transitions[t];
+            uint64_t weight = 0;
+            for (uint32_t i = countBegin[tr.next]; i < countEnd[tr.next]; i++) {
+                weight += countValue[i];
+            }
+            weighted.emplace_back(weight, tr);
+        }
+        
+        std::stable_sort(weighted.begin(), weighted.end(),
+                         [](const std::pair<uint64_t, RowTransition>& a,
+                            const std::pair<uint64_t, RowTransition>& b) {
+                             return a.first > b.first;
+                         });
+        
+        for (size_t i = 0; i < weighted.size(); i++) {
+            transitions[transitionBegin[state] + i] = weighted[i].second;
+        }
+    }
+}
+
+uint64_t FleetSampler::countOf(uint32_t state, int fleet) const {
+    for (uint32_t i = countBegin[state]; i < countEnd[state]; i++) {
+        if (countFleet[i] == fleet) {
+            return countValue[i];
+        }
+    }
+    return 0;
+}
+
+template <typename Visitor>
+void FleetSampler::expand(int row, uint64_t prev, int col, bool leftOccupied,
+                          uint64_t next, int used, Visitor& visit) const {
+    if (col == cols) {
+        visit(next, used);
+        return;
+    }
+    
+    int shift = col * BITS_PER_CELL;
+    int above = cellAt(prev, col);
+    
+    // Вертикальний корабель з попереднього рядка продовжується
+    if (above != CELL_EMPTY && above != CELL_END) {
+        if (leftOccupied) return;
+        
+        uint64_t value = above > 1 ? above - 1 : CELL_END;
+        expand(row, prev, col + 1, true, next | (value << shift), used, visit);
+        return;
+    }
+    
+    // Клітинка залишається порожньою
+    expand(row, prev, col + 1, false, next, used, visit);
+    
+    // Новий корабель не може торкатися кораблів зліва, зверху та по діагоналі
+    if (above == CELL_END || leftOccupied) return;
+    if (cellAt(prev, col - 1) != CELL_EMPTY || cellAt(prev, col + 1) != CELL_EMPTY) return;
+    
+    for (size_t i = 0; i < sizes.size(); i++) {
+        if (digit(used, static_cast<int>(i)) == sizeCounts[i]) continue;
+        
+        int size = sizes[i];
+        int withShip = used + fleetRadix[i];
+        
+        // Горизонтальний корабель у клітинках col..col+size-1
+        if (col + size <= cols) {
+            bool free = true;
+            uint64_t cells = next;
+            for (int c = col; c < col + size; c++) {
+                if (cellAt(prev, c + 1) != CELL_EMPTY) {
+                    free = false;
+                    break;
+                }
+                cells |= uint64_t(CELL_END) << (c * BITS_PER_CELL);
+            }
+            
+            if (free) {
+                expand(row, prev, col + size, true, cells, withShip, visit);
+            }
+        }
+        
+        // Вертикальний корабель, який займе ще size-1 рядків нижче
+        if (size > 1 && row + size <= rows) {
+            expand(row, prev, col + 1, true, next | (uint64_t(size - 1) << shift), withShip, visit);
+        }
+    }
+}
+
+const FleetSampler::RowTransition& FleetSampler::pickTransition(uint32_t state, int fleet,
+                                                                std::mt19937& gen) const {
+    std::uniform_int_distribution<uint64_t> dist(0, countOf(state, fleet) - 1);
+    uint64_t pick = dist(gen);
+    
+    for (uint32_t t = transitionBegin[state]; t < transitionBegin[state + 1]; t++) {
+        const RowTransition& tr = transitions[t];
+        if (!fleetContains[fleet * fleetStates + tr.used]) continue;
+        
+        uint64_t weight = countOf(tr.next, fleet - tr.used);
+        if (pick < weight) {
+            return tr;
+        }
+        pick -= weight;
+    }
+    
+    // Сума ваг дорівнює countOf(state, fleet), тож сюди не доходимо
+    return transitions[transitionBegin[state + 1] - 1];
+}
\ No newline at end of file
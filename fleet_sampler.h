@@ -0,0 +1,162 @@
+#ifndef FLEET_SAMPLER_H
+#define FLEET_SAMPLER_H
+
+#include "common.h"
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+// Рівномірний вибір розстановки флоту.
+//
+// Кількість розстановок рахується динамічним програмуванням по рядках дошки.
+// Стан між рядками - профіль попереднього рядка: для кожної колонки порожньо,
+// корабель тут закінчується, або вертикальний корабель, якому потрібно ще k
+// клітинок. Для кожного стану зберігається кількість способів заповнити решту
+// дошки окремо для кожного набору ще не розміщених кораблів. Правило "кораблі
+// не торкаються" перевіряється при переході між рядками.
+//
+// Розстановка вибирається за один прохід зверху вниз: кожен перехід береться
+// з імовірністю, пропорційною кількості розстановок, які він продовжує, тому
+// всі розстановки рівноймовірні і повторних спроб немає.
+//
+// Таблиці залежать лише від розмірів дошки та флоту, тож для кожної
+// геометрії будується один семплер (forGeometry), а sample() працює
+// з дошкою відповідної геометрії.
+class FleetSampler {
+public:
+    static const int BITS_PER_CELL = 3;
+
+    // Значення колонки в профілі рядка
+    static const int CELL_EMPTY = 0;  // Порожня клітинка
+    static const int CELL_END = 7;    // Корабель, який тут закінчується
+    // 1..CELL_END-1 - вертикальний корабель, якому потрібно ще стільки рядків
+
+    // Найбільші розміри, які вміщує профіль рядка
+    static const int MAX_COLS = 64 / BITS_PER_CELL;
+    static const int MAX_SHIP = CELL_END;
+
+private:
+    int rows;
+    int cols;
+
+    // Розміри кораблів флоту (без повторів) та кількість кораблів кожного розміру
+    std::vector<int> sizes;
+    std::vector<int> sizeCounts;
+
+    // Набір кораблів - число в змішаній системі числення з цифрою на кожен розмір
+    std::vector<int> fleetRadix;
+    int fleetStates;
+    int fullFleet;
+
+    // fleetContains[f * fleetStates + g] - чи є набір g частиною набору f
+    std::vector<char> fleetContains;
+
+    // Перехід до наступного рядка: стан наступного рядка та використані кораблі
+    struct RowTransition {
+        uint32_t next;
+        uint32_t used;
+    };
+
+    // Стани всіх рядків поспіль; стан 0 - порожній рядок над дошкою
+    std::vector<uint64_t> stateProfile;
+    std::vector<uint32_t> transitionBegin;
+    std::vector<RowTransition> transitions;
+
+    // Кількість способів заповнити решту дошки для кожного досяжного набору
+    // кораблів стану: записи стану лежать у [countBegin[state], countEnd[state])
+    std::vector<uint32_t> countBegin;
+    std::vector<uint32_t> countEnd;
+    std::vector<uint16_t> countFleet;
+    std::vector<uint64_t> countValue;
+
+    uint64_t layoutCount;
+
+    int cellAt(uint64_t profile, int col) const {
+        if (col < 0 || col >= cols) return CELL_EMPTY;
+        return static_cast<int>((profile >> (col * BITS_PER_CELL)) & 7);
+    }
+
+    int digit(int fleet, int sizeIndex) const {
+        return (fleet / fleetRadix[sizeIndex]) % (sizeCounts[sizeIndex] + 1);
+    }
+
+    uint64_t countOf(uint32_t state, int fleet) const;
+
+    // Перебір усіх варіантів рядка row під рядком з профілем prev
+    template <typename Visitor>
+    void expand(int row, uint64_t prev, int col, bool leftOccupied,
+                uint64_t next, int used, Visitor& visit) const;
+
+    // Вибрати перехід з рядка state з імовірністю, пропорційною кількості продовжень
+    const RowTransition& pickTransition(uint32_t state, int fleet, std::mt19937& gen) const;
+
+    // Розмістити кораблі, які починаються в рядку row
+    template <typename BoardType>
+    void placeRowShips(BoardType& board, int row, uint64_t prev, uint64_t next) const;
+
+public:
+    FleetSampler(int rowCount, int colCount, const std::vector<ShipType>& fleet);
+
+    // Семплер для геометрії дошки (будується один раз при першому зверненні)
+    template <typename Geometry>
+    static const FleetSampler& forGeometry() {
+        static_assert(Geometry::COLS <= MAX_COLS, "Row profile does not fit in 64 bits");
+        static_assert(Geometry::MAX_SHIP_SIZE <= MAX_SHIP, "Ship is too long for the row profile");
+        
+        static const FleetSampler sampler(Geometry::ROWS, Geometry::COLS,
+                                          std::vector<ShipType>(std::begin(Geometry::FLEET),
+                                                                std::end(Geometry::FLEET)));
+        return sampler;
+    }
+
+    // Загальна кількість допустимих розстановок флоту
+    uint64_t getLayoutCount() const { return layoutCount; }
+
+    // Розставити флот на дошці, рівномірно серед усіх допустимих розстановок
+    template <typename BoardType>
+    void sample(BoardType& board, std::mt19937& gen) const;
+};
+
+template <typename BoardType>
+void FleetSampler::placeRowShips(BoardType& board, int row, uint64_t prev, uint64_t next) const {
+    for (int col = 0; col < cols; col++) {
+        int value = cellAt(next, col);
+        
+        // Порожня клітинка або продовження вертикального корабля
+        if (value == CELL_EMPTY || cellAt(prev, col) != CELL_EMPTY) {
+            continue;
+        }
+        
+        if (value != CELL_END) {
+            board.placeShip(static_cast<ShipType>(value + 1), Coordinate(row, col), VERTICAL);
+            continue;
+        }
+        
+        // Сусідні клітинки рядка можуть належати лише одному горизонтальному кораблю
+        int size = 1;
+        while (col + size < cols && cellAt(next, col + size) == CELL_END) {
+            size++;
+        }
+        board.placeShip(static_cast<ShipType>(size), Coordinate(row, col), HORIZONTAL);
+        col += size - 1;
+    }
+}
+
+template <typename BoardType>
+void FleetSampler::sample(BoardType& board, std::mt19937& gen) const {
+    board.clear();
+    
+    uint32_t state = 0;
+    int fleet = fullFleet;
+    
+    for (int row = 0; row < rows; row++) {
+        const RowTransition& chosen = pickTransition(state, fleet, gen);
+        placeRowShips(board, row, stateProfile[state], stateProfile[chosen.next]);
+        
+        state = chosen.next;
+        fleet -= chosen.used;
+    }
+}
+
+#endif // FLEET_SAMPLER_H
\ No newline at end of file
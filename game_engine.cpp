@@ -0,0 +1,118 @@
+#include "game_engine.h"
+#include <algorithm>
+
+GameEngine::GameEngine(Player& first, Player& second)
+    : pace(Pace::INTERACTIVE), current(0), turnNumber(1), winner(-1), over(false) {
+    seats[0] = &first;
+    seats[1] = &second;
+    setMoveTime(std::chrono::seconds(1));
+}
+
+void GameEngine::addObserver(GameObserver& observer) {
+    observers.push_back(&observer);
+}
+
+void GameEngine::removeObserver(GameObserver& observer) {
+    observers.erase(std::remove(observers.begin(), observers.end(), &observer), observers.end());
+}
+
+bool GameEngine::checkLeft(int seat) {
+    if (!seats[seat]->hasLeft()) {
+        return false;
+    }
+    
+    over = true;
+    for (GameObserver* observer : observers) {
+        observer->onGameAborted(*this, seat);
+    }
+    return true;
+}
+
+void GameEngine::placeShips() {
+    for (int seat = 0; seat < SEATS; seat++) {
+        for (GameObserver* observer : observers) {
+            observer->onPlacementStarted(*this, seat);
+        }
+        
+        seats[seat]->placeShips();
+        for (GameObserver* observer : observers) {
+            observer->onShipsPlaced(*this, seat);
+        }
+    }
+}
+
+bool GameEngine::playTurn() {
+    if (over) {
+        return false;
+    }
+    
+    Player& shooter = *seats[current];
+    Player& target = *seats[opponentOf(current)];
+    
+    for (GameObserver* observer : observers) {
+        observer->onTurnStarted(*this, current);
+    }
+    
+    // Стріляємо, доки постріл не буде правильним
+    Coordinate coord;
+    ShotResult result = SHOT_INVALID;
+    
+    for (int attempt = 0; result == SHOT_INVALID; attempt++) {
+        if (attempt == MAX_INVALID_SHOTS && !shooter.isInteractive()) {
+            over = true;
+            for (GameObserver* observer : observers) {
+                observer->onGameAborted(*this, current);
+            }
+            return false;
+        }
+        
+        coord = shooter.chooseTarget(MoveClock::now() + moveTime[current], pace);
+        if (checkLeft(current)) {
+            return false;
+        }
+        
+        result = coord.isValid() ? target.receiveShot(coord) : SHOT_INVALID;
+        if (checkLeft(opponentOf(current))) {
+            return false;
+        }
+        
+        if (result == SHOT_INVALID) {
+            // Гравець (зокрема віддалений) має знати, що постріл не зараховано
+            shooter.processShotResult(coord, result);
+            for (GameObserver* observer : observers) {
+                observer->onInvalidShot(*this, current, coord);
+            }
+        }
+    }
+    
+    shooter.processShotResult(coord, result);
+    if (checkLeft(current)) {
+        return false;
+    }
+    
+    for (GameObserver* observer : observers) {
+        observer->onShot(*this, current, coord, result);
+    }
+    
+    if (result == SHOT_WIN) {
+        over = true;
+        winner = current;
+        for (GameObserver* observer : observers) {
+            observer->onGameOver(*this, winner);
+        }
+        return false;
+    }
+    
+    // Хід переходить до суперника; новий номер - після обох пострілів
+    current = opponentOf(current);
+    if (current == 0) {
+        turnNumber++;
+    }
+    return true;
+}
+
+int GameEngine::play() {
+    while (playTurn()) {
+    }
+    return winner;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#ifndef GAME_ENGINE_H
+#define GAME_ENGINE_H
+
+#include "common.h"
+#include "player.h"
+#include <chrono>
+#include <vector>
+
+class GameEngine;
+
+// Спостерігач за грою. Рушій сам нічого не виводить - консольні режими,
+// сервер і симуляції реагують на події через цей інтерфейс.
+// Усі методи викликаються з потоку, в якому працює рушій
+class GameObserver {
+public:
+    virtual ~GameObserver() = default;
+    
+    // Гравець seat починає розставляти кораблі
+    virtual void onPlacementStarted(const GameEngine& /*game*/, int /*seat*/) {}
+    
+    // Гравець seat розставив кораблі
+    virtual void onShipsPlaced(const GameEngine& /*game*/, int /*seat*/) {}
+    
+    // Гравець seat починає хід
+    virtual void onTurnStarted(const GameEngine& /*game*/, int /*seat*/) {}
+    
+    // Ціль поза дошкою або вже обстріляна - гравець стріляє ще раз
+    virtual void onInvalidShot(const GameEngine& /*game*/, int /*seat*/, const Coordinate& /*target*/) {}
+    
+    // Постріл гравця seat і його результат (уже записаний на tracking board)
+    virtual void onShot(const GameEngine& /*game*/, int /*seat*/, const Coordinate& /*target*/,
+                        ShotResult /*result*/) {}
+    
+    // Гравець winner потопив увесь флот суперника
+    virtual void onGameOver(const GameEngine& /*game*/, int /*winner*/) {}
+    
+    // Гра перервана: гравець seat вийшов (розрив з'єднання)
+    // або, якщо це AI, забагато разів поспіль стріляв неправильно
+    virtual void onGameAborted(const GameEngine& /*game*/, int /*seat*/) {}
+};
+
+// Правила гри без вводу-виводу: розстановка і черговість пострілів для
+// двох гравців. Гравців і спостерігачів рушій не володіє
+class GameEngine {
+public:
+    static constexpr int SEATS = 2;
+    
+    // Скільки неправильних пострілів поспіль дозволено за один хід AI
+    // (Player::isInteractive() == false); людину просимо стріляти ще раз без ліміту
+    static constexpr int MAX_INVALID_SHOTS = 100;
+    
+private:
+    Player* seats[SEATS];
+    std::vector<GameObserver*> observers;
+    
+    std::chrono::microseconds moveTime[SEATS];   // Час на хід кожного гравця
+    Pace pace;
+    
+    int current;     // Чий хід
+    int turnNumber;  // Номер ходу; росте, коли обидва гравці вистрілили
+    int winner;      // -1 - переможця ще немає
+    bool over;
+    
+    // Гравець вийшов з гри - сповіщаємо і зупиняємось
+    bool checkLeft(int seat);
+    
+public:
+    // first ходить першим
+    GameEngine(Player& first, Player& second);
+    
+    void addObserver(GameObserver& observer);
+    void removeObserver(GameObserver& observer);
+    
+    // Дедлайн ходу гравця seat - поточний момент + його час на хід
+    void setMoveTime(int seat, std::chrono::microseconds time) { moveTime[seat] = time; }
+    std::chrono::microseconds getMoveTime(int seat) const { return moveTime[seat]; }
+    
+    // Однаковий час на хід для обох гравців
+    void setMoveTime(std::chrono::microseconds time) {
+        for (int seat = 0; seat < SEATS; seat++) moveTime[seat] = time;
+    }
+    
+    // Pace::HEADLESS - AI ходять без пауз
+    void setPace(Pace newPace) { pace = newPace; }
+    Pace getPace() const { return pace; }
+    
+    // Обидва гравці розставляють кораблі (у порядку місць)
+    void placeShips();
+    
+    // Один постріл поточного гравця. false - гра закінчена
+    bool playTurn();
+    
+    // Ходи до кінця гри (кораблі вже розставлені).
+    // Повертає місце переможця або -1, якщо гру перервано
+    int play();
+    
+    Player& getPlayer(int seat) { return *seats[seat]; }
+    const Player& getPlayer(int seat) const { return *seats[seat]; }
+    static int opponentOf(int seat) { return 1 - seat; }
+    
+    int getCurrentSeat() const { return current; }
+    int getTurnNumber() const { return turnNumber; }
+    int getWinner() const { return winner; }
+    bool isOver() const { return over; }
+};
+
+#endif // GAME_ENGINE_H
\ No newline at end of file
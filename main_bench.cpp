@@ -0,0 +1,563 @@
+#include "common.h"
+#include "board.h"
+#include "player.h"
+#include "ai.h"
+#include "network.h"
+#include "sparse_board.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Мікробенчмарки гарячих шляхів дошки, гравця, AI та побудови мережевих повідомлень,
+// а також розрідженої дошки на полі "океан".
+//
+// Кожен бенчмарк - підготовка вхідних даних (копії дошок, скинуті AI), яка
+// не вимірюється, і тіло, яке виконує задану кількість операцій. Кількість
+// операцій у вибірці підбирається так, щоб вибірка тривала не менше
+// SAMPLE_TARGET; далі йде прогрів (вибірки відкидаються), потім заміри.
+// Назва бенчмарку перелічує все, що входить у вимірювану операцію.
+// Результат - час однієї операції в наносекундах: медіана, перцентилі,
+// мінімум, максимум і середнє, у форматі JSON у стандартний вивід, разом
+// з прапорцями збірки, які впливають на час (перевірка дошки
+// SEABATTLE_CHECK_BOARD, NDEBUG). Поступ пишеться в stderr.
+//
+// Використання: seabattle_bench [фільтр] [вибірок] [прогрів_мс]
+// фільтр - підрядок назви бенчмарку ("" або "all" - усі)
+
+namespace {
+    const std::chrono::milliseconds SAMPLE_TARGET(5);
+    
+    // Розмір наборів вхідних даних (дошок, кораблів, партій)
+    const int POOL_SIZE = 64;
+    
+    // Поле "океан" для SparseBoard
+    const int OCEAN_SIZE = 10000;
+    const int OCEAN_SHIPS = 400;
+    
+    // Найкоротша партія: по пострілу в кожну клітинку флоту
+    const int MIN_GAME_SHOTS = [] {
+        int cells = 0;
+        for (ShipType type : StandardGeometry::FLEET) {
+            cells += static_cast<int>(type);
+        }
+        return cells;
+    }();
+    
+    typedef std::chrono::steady_clock BenchClock;
+    
+    // Результат, який компілятор не може викинути
+    volatile uint64_t sink;
+    
+    inline void consume(uint64_t value) {
+        sink = sink + value;
+    }
+    
+    struct Benchmark {
+        std::string name;
+        std::string unit;   // Що таке одна операція
+        
+        // Підготувати дані щонайменше для operations операцій (не вимірюється;
+        // порожня - підготовка не потрібна)
+        std::function<void(long long operations)> setup;
+        
+        // Виконати щонайменше operations операцій; повертає фактичну кількість
+        // (тіла, що працюють цілими партіями, можуть виконати трохи більше)
+        std::function<long long(long long operations)> body;
+    };
+    
+    struct Summary {
+        long long operationsPerSample;
+        double median, p10, p90, p99, min, max, mean;
+    };
+    
+    double percentile(const std::vector<double>& sorted, double fraction) {
+        double position = fraction * (sorted.size() - 1);
+        size_t lower = static_cast<size_t>(position);
+        size_t upper = std::min(lower + 1, sorted.size() - 1);
+        return sorted[lower] + (sorted[upper] - sorted[lower]) * (position - lower);
+    }
+    
+    struct Sample {
+        double nanoseconds;
+        long long operations;
+    };
+    
+    // Підготовка і один вимірюваний виклик body(operations)
+    Sample timeRun(const Benchmark& benchmark, long long operations) {
+        if (benchmark.setup) {
+            benchmark.setup(operations);
+        }
+        
+        BenchClock::time_point start = BenchClock::now();
+        long long done = benchmark.body(operations);
+        return {std::chrono::duration<double, std::nano>(BenchClock::now() - start).count(), done};
+    }
+    
+    Summary run(const Benchmark& benchmark, int samples, std::chrono::milliseconds warmup) {
+        // Калібрування: подвоюємо кількість операцій, доки вибірка не стане досить довгою
+        double target = std::chrono::duration<double, std::nano>(SAMPLE_TARGET).count();
+        long long operations = 1;
+        while (timeRun(benchmark, operations).nanoseconds < target && operations < (1LL << 40)) {
+            operations *= 2;
+        }
+        
+        // Прогрів: кеші, передбачувач переходів, частота процесора
+        BenchClock::time_point warmupEnd = BenchClock::now() + warmup;
+        while (BenchClock::now() < warmupEnd) {
+            timeRun(benchmark, operations);
+        }
+        
+        std::vector<double> perOperation;
+        perOperation.reserve(samples);
+        for (int sample = 0; sample < samples; sample++) {
+            Sample result = timeRun(benchmark, operations);
+            perOperation.push_back(result.nanoseconds / result.operations);
+        }
+        std::sort(perOperation.begin(), perOperation.end());
+        
+        Summary summary;
+        summary.operationsPerSample = operations;
+        summary.median = percentile(perOperation, 0.5);
+        summary.p10 = percentile(perOperation, 0.1);
+        summary.p90 = percentile(perOperation, 0.9);
+        summary.p99 = percentile(perOperation, 0.99);
+        summary.min = perOperation.front();
+        summary.max = perOperation.back();
+        summary.mean = std::accumulate(perOperation.begin(), perOperation.end(), 0.0) / samples;
+        return summary;
+    }
+    
+    // ==================== Вхідні дані ====================
+    
+    // Дошки з випадковими флотами і випадковий порядок пострілів по кожній
+    struct BoardPool {
+        std::vector<Board> boards;
+        std::vector<std::vector<Coordinate>> shotOrders;
+        
+        explicit BoardPool(std::mt19937& gen) {
+            std::vector<Coordinate> cells;
+            for (int index = 0; index < Board::CELLS; index++) {
+                cells.push_back(Coordinate(index / Board::COLS, index % Board::COLS));
+            }
+            
+            for (int i = 0; i < POOL_SIZE; i++) {
+                Board board;
+                board.placeShipsRandomly(gen);
+                boards.push_back(board);
+                
+                std::shuffle(cells.begin(), cells.end(), gen);
+                shotOrders.push_back(cells);
+            }
+        }
+    };
+    
+    // Записана партія: постріли і результати до перемоги
+    struct RecordedGame {
+        std::vector<Coordinate> shots;
+        std::vector<ShotResult> results;
+    };
+    
+    // Партії AI проти дошок з пулу. AI створюються один раз і скидаються
+    // перед кожною вибіркою разом з копіями дошок, поза вимірюванням
+    struct AIGames {
+        std::vector<std::unique_ptr<AIPlayer>> players;
+        std::vector<Board> targets;
+        int games = 0;
+        
+        // Далекий дедлайн: у темпі HEADLESS AI на нього не чекають
+        MoveClock::time_point deadline;
+    };
+    
+    // Бенчмарк AI: операція - один хід (chooseTarget, Board::shoot, processShotResult)
+    template <typename MakeAI>
+    Benchmark aiMoves(const std::string& name, const BoardPool& pool, MakeAI makeAI) {
+        std::shared_ptr<AIGames> state = std::make_shared<AIGames>();
+        
+        Benchmark benchmark;
+        benchmark.name = name;
+        benchmark.unit = "хід";
+        
+        benchmark.setup = [&pool, state, makeAI](long long operations) {
+            state->games = static_cast<int>((operations + MIN_GAME_SHOTS - 1) / MIN_GAME_SHOTS);
+            while (static_cast<int>(state->players.size()) < state->games) {
+                state->players.push_back(makeAI());
+            }
+            
+            state->targets.resize(state->games);
+            for (int game = 0; game < state->games; game++) {
+                state->players[game]->reset();
+                state->players[game]->setSeed(static_cast<uint32_t>(game));
+                state->targets[game] = pool.boards[game % POOL_SIZE];
+            }
+            state->deadline = MoveClock::now() + std::chrono::hours(1);
+        };
+        
+        benchmark.body = [state](long long operations) {
+            long long moves = 0;
+            for (int game = 0; game < state->games && moves < operations; game++) {
+                AIPlayer& ai = *state->players[game];
+                Board& target = state->targets[game];
+                
+                for (int shot = 0; shot < Board::CELLS; shot++) {
+                    Coordinate coord = ai.chooseTarget(state->deadline, Pace::HEADLESS);
+                    ShotResult result = target.shoot(coord);
+                    ai.processShotResult(coord, result);
+                    moves++;
+                    
+                    if (result == SHOT_WIN || result == SHOT_INVALID) break;
+                }
+            }
+            return moves;
+        };
+        
+        return benchmark;
+    }
+    
+    // Океан для пострілів: свіжий флот і цілі, половина з яких - клітинки кораблів
+    struct OceanShots {
+        SparseBoard board;
+        std::vector<Coordinate> targets;
+        std::mt19937 gen;
+        
+        OceanShots() : board(OCEAN_SIZE, OCEAN_SIZE), gen(2) {}
+    };
+    
+    // ==================== Бенчмарки ====================
+    
+    std::vector<Benchmark> createBenchmarks(const BoardPool& pool, const std::vector<Ship>& ships,
+                                            const std::vector<RecordedGame>& games) {
+        std::vector<Benchmark> benchmarks;
+        
+        // Копії дошок для пострілів готуються до вимірювання
+        std::shared_ptr<std::vector<Board>> shotBoards = std::make_shared<std::vector<Board>>();
+        benchmarks.push_back({"Board::shoot", "постріл (100 пострілів по кожній дошці)",
+            [&pool, shotBoards](long long operations) {
+                shotBoards->resize((operations + Board::CELLS - 1) / Board::CELLS);
+                for (size_t i = 0; i < shotBoards->size(); i++) {
+                    (*shotBoards)[i] = pool.boards[i % POOL_SIZE];
+                }
+            },
+            [&pool, shotBoards](long long) {
+                uint64_t hits = 0;
+                for (size_t i = 0; i < shotBoards->size(); i++) {
+                    Board& board = (*shotBoards)[i];
+                    for (const Coordinate& coord : pool.shotOrders[i % POOL_SIZE]) {
+                        hits += board.shoot(coord) != SHOT_MISS;
+                    }
+                }
+                consume(hits);
+                return static_cast<long long>(shotBoards->size()) * Board::CELLS;
+            }});
+        
+        // Розстановка сама очищає дошку
+        std::shared_ptr<std::mt19937> placementGen = std::make_shared<std::mt19937>(1);
+        benchmarks.push_back({"Board::placeShipsRandomly", "розстановка флоту",
+            nullptr,
+            [placementGen](long long operations) {
+                Board board;
+                for (long long i = 0; i < operations; i++) {
+                    consume(board.placeShipsRandomly(*placementGen));
+                    consume(board.getShipMask().count());
+                }
+                return operations;
+            }});
+        
+        benchmarks.push_back({"Board::canPlaceShip", "перевірка корабля на дошці з флотом",
+            nullptr,
+            [&pool, &ships](long long operations) {
+                uint64_t allowed = 0;
+                for (long long i = 0; i < operations; i++) {
+                    allowed += pool.boards[i % POOL_SIZE].canPlaceShip(ships[i % ships.size()]);
+                }
+                consume(allowed);
+                return operations;
+            }});
+        
+        // Гравці скидаються до вимірювання, по одному на записану партію
+        std::shared_ptr<std::vector<Player>> replayPlayers = std::make_shared<std::vector<Player>>();
+        benchmarks.push_back({"Player::processShotResult", "результат пострілу",
+            [&games, replayPlayers](long long operations) {
+                long long shots = 0;
+                size_t count = 0;
+                for (; shots < operations; count++) {
+                    shots += static_cast<long long>(games[count % games.size()].shots.size());
+                }
+                
+                replayPlayers->resize(count);
+                for (Player& player : *replayPlayers) {
+                    player.reset();
+                }
+            },
+            [&games, replayPlayers](long long) {
+                long long done = 0;
+                for (size_t i = 0; i < replayPlayers->size(); i++) {
+                    const RecordedGame& game = games[i % games.size()];
+                    Player& player = (*replayPlayers)[i];
+                    for (size_t shot = 0; shot < game.shots.size(); shot++) {
+                        player.processShotResult(game.shots[shot], game.results[shot]);
+                    }
+                    consume(player.getHitsCount());
+                    done += static_cast<long long>(game.shots.size());
+                }
+                return done;
+            }});
+        
+        // Лише стан добивання: tracking board не оновлюється, тож isValidTarget
+        // відкидає тільки клітинки поза дошкою і черга цілей не менша, ніж у грі
+        std::shared_ptr<std::vector<std::unique_ptr<SmartAI>>> replayAIs =
+            std::make_shared<std::vector<std::unique_ptr<SmartAI>>>();
+        benchmarks.push_back({"SmartAI::updateAfterShot", "результат пострілу",
+            [&games, replayAIs](long long operations) {
+                long long shots = 0;
+                size_t count = 0;
+                for (; shots < operations; count++) {
+                    shots += static_cast<long long>(games[count % games.size()].shots.size());
+                }
+                
+                while (replayAIs->size() < count) {
+                    replayAIs->push_back(std::unique_ptr<SmartAI>(new SmartAI()));
+                }
+                for (size_t i = 0; i < count; i++) {
+                    (*replayAIs)[i]->reset();
+                }
+                replayAIs->resize(count);
+            },
+            [&games, replayAIs](long long) {
+                long long done = 0;
+                for (size_t i = 0; i < replayAIs->size(); i++) {
+                    const RecordedGame& game = games[i % games.size()];
+                    SmartAI& ai = *(*replayAIs)[i];
+                    for (size_t shot = 0; shot < game.shots.size(); shot++) {
+                        ai.updateAfterShot(game.shots[shot], game.results[shot]);
+                    }
+                    done += static_cast<long long>(game.shots.size());
+                }
+                return done;
+            }});
+        
+        benchmarks.push_back(aiMoves("SmartAI::chooseTarget+Board::shoot+processShotResult", pool, [] {
+            return std::unique_ptr<AIPlayer>(new SmartAI());
+        }));
+        
+        benchmarks.push_back(aiMoves("SmartAI::chooseTarget+Board::shoot+processShotResult (з розв'язувачем)", pool, [] {
+            std::unique_ptr<AIPlayer> ai(new SmartAI());
+            ai->setEndgameThreshold(EndgameSolver::RECOMMENDED_MAX_LAYOUTS);
+            return ai;
+        }));
+        
+        benchmarks.push_back(aiMoves("RandomAI::chooseTarget+Board::shoot+processShotResult", pool, [] {
+            return std::unique_ptr<AIPlayer>(new RandomAI());
+        }));
+        
+        std::vector<ShipType> oceanFleet;
+        for (int i = 0; i < OCEAN_SHIPS; i++) {
+            oceanFleet.push_back(StandardGeometry::FLEET[i % StandardGeometry::FLEET_SIZE]);
+        }
+        
+        std::shared_ptr<std::mt19937> oceanGen = std::make_shared<std::mt19937>(1);
+        benchmarks.push_back({"SparseBoard::placeShipsRandomly (10000x10000, 400 кораблів)", "розстановка флоту",
+            nullptr,
+            [oceanGen, oceanFleet](long long operations) {
+                SparseBoard board(OCEAN_SIZE, OCEAN_SIZE);
+                for (long long i = 0; i < operations; i++) {
+                    consume(board.placeShipsRandomly(oceanFleet, *oceanGen));
+                }
+                return operations;
+            }});
+        
+        std::shared_ptr<OceanShots> ocean = std::make_shared<OceanShots>();
+        benchmarks.push_back({"SparseBoard::shoot (10000x10000, 400 кораблів)", "постріл (половина - по кораблях)",
+            [ocean, oceanFleet](long long operations) {
+                ocean->board.placeShipsRandomly(oceanFleet, ocean->gen);
+                const std::vector<Ship>& fleet = ocean->board.getShips();
+                
+                std::uniform_int_distribution<> cell(0, OCEAN_SIZE - 1);
+                std::uniform_int_distribution<> shipPick(0, static_cast<int>(fleet.size()) - 1);
+                ocean->targets.clear();
+                for (long long i = 0; i < operations; i++) {
+                    if (i % 2) {
+                        ocean->targets.push_back(Coordinate(cell(ocean->gen), cell(ocean->gen)));
+                    } else {
+                        const Ship& ship = fleet[shipPick(ocean->gen)];
+                        int offset = std::uniform_int_distribution<>(0, ship.size - 1)(ocean->gen);
+                        ocean->targets.push_back(ship.orientation == HORIZONTAL
+                            ? Coordinate(ship.start.row, ship.start.col + offset)
+                            : Coordinate(ship.start.row + offset, ship.start.col));
+                    }
+                }
+            },
+            [ocean](long long operations) {
+                uint64_t hits = 0;
+                for (const Coordinate& coord : ocean->targets) {
+                    hits += ocean->board.shoot(coord) != SHOT_MISS;
+                }
+                consume(hits);
+                return operations;
+            }});
+        
+        // Повідомлення йде в мережу байтами структури (NetworkManager::sendMessage),
+        // тож без сокета вимірюється лише побудова повідомлення і копіювання байтів
+        benchmarks.push_back({"NetworkMessage(MSG_SHOT)+memcpy у буфер", "повідомлення",
+            nullptr,
+            [](long long operations) {
+                char wire[sizeof(NetworkMessage)];
+                uint64_t checksum = 0;
+                for (long long i = 0; i < operations; i++) {
+                    NetworkMessage msg(MSG_SHOT, static_cast<int>(i % Board::ROWS), static_cast<int>(i % Board::COLS));
+                    std::memcpy(wire, &msg, sizeof(msg));
+                    checksum += static_cast<unsigned char>(wire[i % sizeof(wire)]);
+                }
+                consume(checksum);
+                return operations;
+            }});
+        
+        benchmarks.push_back({"memcpy з буфера+NetworkMessage(MSG_SHOT)->Coordinate", "повідомлення",
+            nullptr,
+            [](long long operations) {
+                char wire[POOL_SIZE][sizeof(NetworkMessage)];
+                for (int i = 0; i < POOL_SIZE; i++) {
+                    NetworkMessage msg(MSG_SHOT, i % Board::ROWS, i / Board::ROWS);
+                    std::memcpy(wire[i], &msg, sizeof(msg));
+                }
+                
+                uint64_t checksum = 0;
+                for (long long i = 0; i < operations; i++) {
+                    NetworkMessage msg;
+                    std::memcpy(&msg, wire[i % POOL_SIZE], sizeof(msg));
+                    if (msg.type == MSG_SHOT) {
+                        Coordinate coord(msg.data1, msg.data2);
+                        checksum += coord.row * Board::COLS + coord.col;
+                    }
+                }
+                consume(checksum);
+                return operations;
+            }});
+        
+        benchmarks.push_back({"NetworkMessage(MSG_CHAT, текст)+memcpy у буфер", "повідомлення",
+            nullptr,
+            [](long long operations) {
+                const std::string text = "Гарна гра! Ще одну?";
+                char wire[sizeof(NetworkMessage)];
+                uint64_t checksum = 0;
+                for (long long i = 0; i < operations; i++) {
+                    NetworkMessage msg(MSG_CHAT, 0, 0, text);
+                    std::memcpy(wire, &msg, sizeof(msg));
+                    checksum += static_cast<unsigned char>(wire[i % sizeof(wire)]);
+                }
+                consume(checksum);
+                return operations;
+            }});
+        
+        return benchmarks;
+    }
+    
+    // Рядок JSON з екрануванням
+    std::string jsonString(const std::string& value) {
+        std::string result = "\"";
+        for (char c : value) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+                result += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                static const char HEX[] = "0123456789abcdef";
+                result += "\\u00";
+                result += HEX[(c >> 4) & 0xF];
+                result += HEX[c & 0xF];
+            } else {
+                result += c;
+            }
+        }
+        return result + "\"";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::string filter = argc > 1 ? argv[1] : "";
+    int samples = argc > 2 ? std::atoi(argv[2]) : 30;
+    int warmupMs = argc > 3 ? std::atoi(argv[3]) : 200;
+    
+    if (filter == "all") filter.clear();
+    if (samples <= 0 || warmupMs < 0) {
+        std::cerr << "Використання: " << argv[0] << " [фільтр] [вибірок] [прогрів_мс]\n";
+        return 1;
+    }
+    
+    // Однакові вхідні дані в кожному запуску
+    std::mt19937 gen(20240601);
+    BoardPool pool(gen);
+    
+    std::vector<Ship> ships;
+    std::uniform_int_distribution<> coordinate(0, Board::ROWS - 1);
+    for (int i = 0; i < 1024; i++) {
+        ShipType type = StandardGeometry::FLEET[i % StandardGeometry::FLEET_SIZE];
+        ships.push_back(Ship(type, Coordinate(coordinate(gen), coordinate(gen)), i % 2 ? VERTICAL : HORIZONTAL));
+    }
+    
+    std::vector<RecordedGame> games(POOL_SIZE);
+    for (int i = 0; i < POOL_SIZE; i++) {
+        Board board = pool.boards[i];
+        for (const Coordinate& coord : pool.shotOrders[i]) {
+            ShotResult result = board.shoot(coord);
+            games[i].shots.push_back(coord);
+            games[i].results.push_back(result);
+            if (result == SHOT_WIN) break;
+        }
+    }
+    
+    std::vector<Benchmark> benchmarks = createBenchmarks(pool, ships, games);
+    
+    std::cout << "{\n";
+    std::cout << "  \"suite\": \"seabattle\",\n";
+    std::cout << "  \"unit\": \"ns\",\n";
+    std::cout << "  \"samples\": " << samples << ",\n";
+    std::cout << "  \"warmup_ms\": " << warmupMs << ",\n";
+    std::cout << "  \"threads\": " << std::thread::hardware_concurrency() << ",\n";
+    
+    // Прапорці збірки, від яких залежить час операцій з дошкою
+#ifdef SEABATTLE_CHECK_BOARD
+    std::cout << "  \"seabattle_check_board\": true,\n";
+#else
+    std::cout << "  \"seabattle_check_board\": false,\n";
+#endif
+#ifdef NDEBUG
+    std::cout << "  \"ndebug\": true,\n";
+#else
+    std::cout << "  \"ndebug\": false,\n";
+#endif
+    std::cout << "  \"results\": [";
+    
+    bool first = true;
+    for (const Benchmark& benchmark : benchmarks) {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) continue;
+        
+        std::cerr << benchmark.name << "...\n";
+        Summary summary = run(benchmark, samples, std::chrono::milliseconds(warmupMs));
+        
+        std::cout << (first ? "\n" : ",\n");
+        first = false;
+        std::cout << "    {\"name\": " << jsonString(benchmark.name)
+                  << ", \"operation\": " << jsonString(benchmark.unit)
+                  << ", \"operations_per_sample\": " << summary.operationsPerSample
+                  << ", \"median_ns\": " << summary.median
+                  << ", \"p10_ns\": " << summary.p10
+                  << ", \"p90_ns\": " << summary.p90
+                  << ", \"p99_ns\": " << summary.p99
+                  << ", \"min_ns\": " << summary.min
+                  << ", \"max_ns\": " << summary.max
+                  << ", \"mean_ns\": " << summary.mean << "}";
+    }
+    
+    std::cout << (first ? "]\n" : "\n  ]\n");
+    std::cout << "}\n";
+    return 0;
+}
\ No newline at end of file
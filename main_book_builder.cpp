@@ -0,0 +1,84 @@
+#include "common.h"
+#include "board.h"
+#include "ai.h"
+#include "opening_book.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Побудова книги дебютів.
+//
+// Грає партії Монте-Карло AI проти випадкових рівномірних розстановок і для
+// кожної позиції перших depth пострілів записує вибраний AI постріл. Позиції,
+// які вже є в книзі, не рахуються повторно, тож популярні гілки
+// (перші постріли, типові серії промахів) коштують один пошук.
+//
+// Використання: book_builder [файл] [партій] [глибина] [бюджет_мс] [зерно]
+
+int main(int argc, char* argv[]) {
+    std::string path = argc > 1 ? argv[1] : "opening_book.bin";
+    int games = argc > 2 ? std::atoi(argv[2]) : 2000;
+    int depth = argc > 3 ? std::atoi(argv[3]) : 15;
+    int budgetMs = argc > 4 ? std::atoi(argv[4]) : 200;
+    unsigned seed = argc > 5 ? static_cast<unsigned>(std::atoi(argv[5])) : std::random_device()();
+
+    if (games <= 0 || depth <= 0 || budgetMs <= 0) {
+        std::cerr << "Використання: " << argv[0] << " [файл] [партій] [глибина] [бюджет_мс] [зерно]\n";
+        return 1;
+    }
+
+    std::cout << "Будуємо книгу дебютів: " << games << " партій, глибина " << depth
+              << ", " << budgetMs << " мс на позицію\n";
+
+    std::mt19937 gen(seed);
+    std::unordered_map<uint64_t, int> book;
+    long long searches = 0;
+    auto budget = std::chrono::milliseconds(budgetMs);
+
+    for (int game = 0; game < games; game++) {
+        Board board;
+        board.placeShipsUniformly(gen);
+
+        MonteCarloAI ai("Book builder", budget);
+
+        for (int shot = 0; shot < depth; shot++) {
+            uint64_t hash = ai.getTrackingBoard().getHash();
+            Coordinate target;
+
+            auto found = book.find(hash);
+            if (found != book.end()) {
+                target = Coordinate(found->second / Board::COLS, found->second % Board::COLS);
+            } else {
+                target = ai.selectTarget(MonteCarloAI::Clock::now() + budget);
+                if (!Board::contains(target)) break;
+
+                book[hash] = Board::cellIndex(target);
+                searches++;
+            }
+
+            ShotResult result = board.shoot(target);
+            ai.processShotResult(target, result);
+            if (result == SHOT_WIN || result == SHOT_INVALID) break;
+        }
+
+
+        if ((game + 1) % 100 == 0 || game + 1 == games) {
+            std::cout << "  партій: " << game + 1 << ", позицій у книзі: " << book.size()
+                      << ", пошуків: " << searches << "\n";
+        }
+    }
+
+    std::vector<std::pair<uint64_t, int>> entries(book.begin(), book.end());
+    if (!OpeningBook::write(path, entries)) {
+        std::cerr << "Не вдалося записати " << path << "\n";
+        return 1;
+    }
+
+    std::cout << "Книгу записано в " << path << " (" << entries.size() << " позицій)\n";
+    return 0;
+}
\ No newline at end of file
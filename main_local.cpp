@@ -1,6 +1,7 @@
 #include "common.h"
 #include "board.h"
 #include "player.h"
+#include "game_engine.h"
 #include <iostream>
 #include <string>
 
@@ -14,6 +15,84 @@ bool askPlayAgain();
 void displayMatchStats(const Player& player1, const Player& player2);
 void displayTurnInfo(const std::string& playerName, int turnNumber);
 void showPlayerSwitchScreen(const std::string& nextPlayer);
+void displayShotResult(ShotResult result);
+
+// Консольний вигляд гри на одному комп'ютері
+class LocalConsoleView : public GameObserver {
+public:
+    void onPlacementStarted(const GameEngine& game, int seat) override {
+        const Player& player = game.getPlayer(seat);
+        
+        // Зміна гравця
+        if (seat > 0) {
+            showPlayerSwitchScreen(player.getName());
+        }
+        
+        std::cout << Color::YELLOW << "═══════════════════════════════════════\n";
+        std::cout << "  " << player.getName() << ", підготуйтесь!\n";
+        std::cout << "═══════════════════════════════════════\n" << Color::RESET;
+        pause();
+        clearScreen();
+    }
+    
+    void onShipsPlaced(const GameEngine& game, int seat) override {
+        std::cout << "\n" << Color::GREEN << "Кораблі гравця " << game.getPlayer(seat).getName() 
+                  << " розміщено!\n" << Color::RESET;
+        pause();
+    }
+    
+    void onTurnStarted(const GameEngine& game, int seat) override {
+        const Player& player = game.getPlayer(seat);
+        
+        // Зміна гравця
+        showPlayerSwitchScreen(player.getName());
+        
+        // Відображення інформації про хід
+        displayTurnInfo(player.getName(), game.getTurnNumber());
+        
+        // Показуємо дошки гравця
+        player.displayBothBoards();
+    }
+    
+    void onInvalidShot(const GameEngine&, int, const Coordinate& target) override {
+        if (!target.isValid()) {
+            std::cout << Color::RED << "Неправильні координати! Спробуйте ще раз.\n" << Color::RESET;
+        } else {
+            displayShotResult(SHOT_INVALID);
+        }
+    }
+    
+    void onShot(const GameEngine& game, int seat, const Coordinate&, ShotResult result) override {
+        displayShotResult(result);
+        
+        // Показуємо оновлену дошку після пострілу
+        std::cout << "\n";
+        game.getPlayer(seat).displayTrackingBoard();
+        
+        if (result != SHOT_WIN) {
+            pause();
+        }
+    }
+    
+    void onGameOver(const GameEngine& game, int winner) override {
+        const Player& winnerPlayer = game.getPlayer(winner);
+        const Player& loser = game.getPlayer(GameEngine::opponentOf(winner));
+        
+        pause();
+        displayVictory(winnerPlayer.getName());
+        
+        // Показуємо статистику
+        displayMatchStats(winnerPlayer, loser);
+        
+        // Показуємо фінальні дошки обох гравців
+        std::cout << Color::CYAN << "Фінальний стан дошок:\n" << Color::RESET;
+        std::cout << "\n" << winnerPlayer.getName() << ":\n";
+        winnerPlayer.displayOwnBoard();
+        
+        std::cout << "\n" << loser.getName() << ":\n";
+        loser.displayOwnBoard();
+    }
+};
 
 void playLocalGame() {
     // Створюємо двох гравців
@@ -35,36 +114,14 @@ void playLocalGame() {
     if (name2.empty()) name2 = "Гравець 2";
     player2.setName(name2);
     
-    clearScreen();
-    
-    // Гравець 1 розміщує кораблі
-    std::cout << Color::YELLOW << "═══════════════════════════════════════\n";
-    std::cout << "  " << player1.getName() << ", підготуйтесь!\n";
-    std::cout << "═══════════════════════════════════════\n" << Color::RESET;
-    pause();
-    clearScreen();
-    
-    player1.placeShips();
-    
-    std::cout << "\n" << Color::GREEN << "Кораблі гравця " << player1.getName() 
-              << " розміщено!\n" << Color::RESET;
-    pause();
-    
-    // Зміна гравця
-    showPlayerSwitchScreen(player2.getName());
+    GameEngine game(player1, player2);
+    LocalConsoleView view;
+    game.addObserver(view);
     
-    // Гравець 2 розміщує кораблі
-    std::cout << Color::YELLOW << "═══════════════════════════════════════\n";
-    std::cout << "  " << player2.getName() << ", підготуйтесь!\n";
-    std::cout << "═══════════════════════════════════════\n" << Color::RESET;
-    pause();
     clearScreen();
     
-    player2.placeShips();
-    
-    std::cout << "\n" << Color::GREEN << "Кораблі гравця " << player2.getName() 
-              << " розміщено!\n" << Color::RESET;
-    pause();
+    // Гравці по черзі розміщують кораблі
+    game.placeShips();
     
     // Початок гри
     clearScreen();
@@ -79,85 +136,7 @@ void playLocalGame() {
     pause();
     
     // Основний ігровий цикл
-    Player* currentPlayer = &player1;
-    Player* opponent = &player2;
-    int turnNumber = 1;
-    bool gameOver = false;
-    
-    while (!gameOver) {
-        // Зміна гравця
-        showPlayerSwitchScreen(currentPlayer->getName());
-        
-        // Відображення інформації про хід
-        displayTurnInfo(currentPlayer->getName(), turnNumber);
-        
-        // Показуємо дошки гравця
-        currentPlayer->displayBothBoards();
-        
-        // Гравець робить постріл
-        bool validShot = false;
-        Coordinate target;
-        ShotResult result;
-        
-        while (!validShot) {
-            target = currentPlayer->chooseTarget();
-            
-            if (!target.isValid()) {
-                std::cout << Color::RED << "Неправильні координати! Спробуйте ще раз.\n" << Color::RESET;
-                continue;
-            }
-            
-            // Робимо постріл
-            result = opponent->receiveShot(target);
-            
-            if (result == SHOT_INVALID) {
-                // Невалідний постріл - просимо спробувати знову
-                continue;
-            }
-            
-            validShot = true;
-        }
-        
-        // Обробляємо результат пострілу
-        currentPlayer->processShotResult(target, result);
-        
-        // Показуємо оновлену дошку після пострілу
-        std::cout << "\n";
-        currentPlayer->displayTrackingBoard();
-        
-        // Перевіряємо чи гра закінчена
-        if (result == SHOT_WIN) {
-            gameOver = true;
-            
-            pause();
-            displayVictory(currentPlayer->getName());
-            
-            // Показуємо статистику
-            displayMatchStats(*currentPlayer, *opponent);
-            
-            // Показуємо фінальні дошки обох гравців
-            std::cout << Color::CYAN << "Фінальний стан дошок:\n" << Color::RESET;
-            std::cout << "\n" << currentPlayer->getName() << ":\n";
-            currentPlayer->displayOwnBoard();
-            
-            std::cout << "\n" << opponent->getName() << ":\n";
-            opponent->displayOwnBoard();
-            
-        } else {
-            // Продовжуємо гру
-            pause();
-            
-            // Міняємо гравців
-            if (currentPlayer == &player1) {
-                currentPlayer = &player2;
-                opponent = &player1;
-            } else {
-                currentPlayer = &player1;
-                opponent = &player2;
-                turnNumber++; // Збільшуємо номер ходу після повного раунду
-            }
-        }
-    }
+    game.play();
 }
 
 int main() {
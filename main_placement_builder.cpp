@@ -0,0 +1,131 @@
+#include "common.h"
+#include "board.h"
+#include "ai.h"
+#include "placement_library.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Побудова бібліотеки розстановок для AIPlayer::placeShips.
+//
+// Генерує кандидатів (рівномірні випадкові розстановки), для кожного грає
+// кілька партій по черзі імовірнісним і розумним AI (DensityAI і SmartAI
+// з розв'язувачем кінця гри, без пауз) і рахує середню кількість пострілів
+// до повного потоплення флоту. Найкращі кандидати потрапляють у бібліотеку
+// з вагою, що росте з цією кількістю.
+//
+// Використання: placement_builder [файл] [кандидатів] [партій] [залишити] [зерно]
+
+namespace {
+    struct Candidate {
+        PlacementLibrary::Layout layout;
+        double averageShots;
+    };
+
+    // Кількість пострілів, за яку ai топить весь флот на board
+    int playOut(const Board& board, AIPlayer& ai, std::mt19937::result_type seed) {
+        Board target = board;
+        ai.reset();
+        ai.setSeed(seed);
+
+        // У темпі HEADLESS AI не чекають на дедлайн
+        MoveClock::time_point deadline = MoveClock::now() + std::chrono::hours(1);
+        int shots = 0;
+
+        while (shots < Board::CELLS) {
+            Coordinate coord = ai.chooseTarget(deadline, Pace::HEADLESS);
+            ShotResult result = target.shoot(coord);
+            ai.processShotResult(coord, result);
+            shots++;
+
+            if (result == SHOT_WIN || result == SHOT_INVALID) break;
+        }
+
+        return shots;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::string path = argc > 1 ? argv[1] : "placement_library.bin";
+    int candidates = argc > 2 ? std::atoi(argv[2]) : 20000;
+    int games = argc > 3 ? std::atoi(argv[3]) : 16;
+    int keep = argc > 4 ? std::atoi(argv[4]) : 1000;
+    unsigned seed = argc > 5 ? static_cast<unsigned>(std::atoi(argv[5])) : std::random_device()();
+
+    if (candidates <= 0 || games <= 0 || keep <= 0) {
+        std::cerr << "Використання: " << argv[0] << " [файл] [кандидатів] [партій] [залишити] [зерно]\n";
+        return 1;
+    }
+    keep = std::min(keep, candidates);
+
+    std::cout << "Оцінюємо " << candidates << " розстановок по " << games << " партій\n";
+
+    // Обидва AI, які грають проти людини за розстановкою з бібліотеки
+    DensityAI densityAI("Placement builder");
+    SmartAI smartAI("Placement builder");
+    AIPlayer* scorers[] = {&densityAI, &smartAI};
+    for (AIPlayer* scorer : scorers) {
+        scorer->setPace(Pace::HEADLESS);
+        scorer->setEndgameThreshold(EndgameSolver::RECOMMENDED_MAX_LAYOUTS);
+    }
+
+    std::mt19937 gen(seed);
+    std::vector<Candidate> scored;
+    scored.reserve(candidates);
+
+    for (int i = 0; i < candidates; i++) {
+        Board board;
+        board.placeShipsUniformly(gen);
+
+        Candidate candidate;
+        if (!PlacementLibrary::fromBoard(board, candidate.layout)) continue;
+
+        long long total = 0;
+        for (int game = 0; game < games; game++) {
+            total += playOut(board, *scorers[game % 2], gen());
+        }
+
+        candidate.averageShots = static_cast<double>(total) / games;
+        scored.push_back(candidate);
+
+        if ((i + 1) % 1000 == 0 || i + 1 == candidates) {
+            std::cout << "  оцінено: " << i + 1 << "\n";
+        }
+    }
+
+    // Найважчі для AI розстановки - на початок
+    std::sort(scored.begin(), scored.end(), [](const Candidate& a, const Candidate& b) {
+        return a.averageShots > b.averageShots;
+    });
+    scored.resize(std::min<size_t>(scored.size(), keep));
+    if (scored.empty()) {
+        std::cerr << "Немає жодної розстановки\n";
+        return 1;
+    }
+
+    // Вага - наскільки розстановка важча за найлегшу з відібраних
+    double cutoff = scored.back().averageShots;
+    std::vector<PlacementLibrary::Layout> layouts;
+    std::vector<float> weights;
+    double sum = 0.0;
+    for (const Candidate& candidate : scored) {
+        layouts.push_back(candidate.layout);
+        weights.push_back(static_cast<float>(candidate.averageShots - cutoff + 1.0));
+        sum += candidate.averageShots;
+    }
+
+    PlacementLibrary library;
+    if (!library.assign(layouts, weights) || !library.save(path)) {
+        std::cerr << "Не вдалося записати " << path << "\n";
+        return 1;
+    }
+
+    std::cout << "Бібліотеку записано в " << path << ": " << layouts.size()
+              << " розстановок, у середньому " << sum / layouts.size() << " пострілів (від "
+              << cutoff << " до " << scored.front().averageShots << ")\n";
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,446 @@
+#include "common.h"
+#include "board.h"
+#include "ai.h"
+#include "game_engine.h"
+#include "plugin_ai.h"
+#include "zobrist.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Самогра AI проти AI (seabattle_sim).
+//
+// Грає задану кількість партій на всіх ядрах. Партії діляться на блоки по
+// BATCH, а блоки розподіляються діапазонами з крадіжкою роботи: потік бере
+// блоки з початку свого діапазону, а коли той закінчився - забирає половину
+// чужого. Кожен потік створює AI один раз і скидає їх перед партією. Кожна
+// партія має власний потік випадкових чисел, виведений із зерна і номера
+// партії, тож результат не залежить від кількості потоків і від того, хто
+// яку партію зіграв.
+//
+// AI-плагін (plugin:<шлях>) грає всі партії блоку одночасно, хід за ходом:
+// позиції всіх партій, де зараз його хід, передаються одним викликом
+// chooseTargets. Склад блоку не залежить від кількості потоків.
+// Монте-Карло AI для цього обмежене кількістю розстановок на хід, а час на
+// хід - лише запобіжник. Статистика збирається в кожному потоці окремо і
+// зводиться наприкінці.
+//
+// Перша партія починається з першого AI, далі AI ходять першими по черзі.
+//
+// Використання: seabattle_sim [партій] [AI 1] [AI 2] [потоків] [зерно]
+// AI: random, smart, smart-density, density, montecarlo, plugin:<шлях до бібліотеки>;
+// потоків = 0 - за кількістю ядер
+//
+// Збірка (-ldl лише на Linux):
+//   g++ -std=c++17 -O2 -pthread main_sim.cpp game_engine.cpp board.cpp player.cpp ai_random.cpp ai_smart.cpp ai_density.cpp ai_montecarlo.cpp plugin_ai.cpp endgame_solver.cpp opening_book.cpp placement_library.cpp opponent_model.cpp density_map.cpp density_kernel.cpp thread_pool.cpp fleet_sampler.cpp -ldl -o seabattle_sim
+
+namespace {
+    const int SEATS = GameEngine::SEATS;
+    
+    // Партій у блоці: потік бере блок за раз, а ходи AI-плагіна в партіях
+    // блоку йдуть одним пакетом
+    const long long BATCH = 64;
+    
+    const std::string PLUGIN_PREFIX = "plugin:";
+    
+    // Розстановок на хід для Монте-Карло AI у симуляції (приблизно 2 мс)
+    // і запобіжник часу, до якого бюджет не повинен доходити
+    const long long MONTE_CARLO_SAMPLES = 4000;
+    const std::chrono::seconds MONTE_CARLO_TIME_LIMIT(1);
+    
+    // library - бібліотека плагіна для kind "plugin:<шлях>"
+    std::unique_ptr<AIPlayer> createAI(const std::string& kind, const std::shared_ptr<PluginLibrary>& library) {
+        if (library) {
+            std::unique_ptr<PluginAI> ai(new PluginAI(library));
+            if (!ai->isReady()) return nullptr;
+            return std::unique_ptr<AIPlayer>(ai.release());
+        }
+        if (kind == "random") return std::unique_ptr<AIPlayer>(new RandomAI("Random AI"));
+        if (kind == "smart") return std::unique_ptr<AIPlayer>(new SmartAI("Smart AI"));
+        if (kind == "smart-density") {
+            SmartAI* ai = new SmartAI("Smart AI (густина)");
+            ai->setDensityHunt(true);
+            return std::unique_ptr<AIPlayer>(ai);
+        }
+        if (kind == "density") return std::unique_ptr<AIPlayer>(new DensityAI("Density AI"));
+        if (kind == "montecarlo") {
+            // Паралелізм дають самі партії - AI рахує в одному потоці
+            MonteCarloAI* ai = new MonteCarloAI("Monte Carlo AI", MONTE_CARLO_TIME_LIMIT, 1);
+            ai->setSampleBudget(MONTE_CARLO_SAMPLES);
+            return std::unique_ptr<AIPlayer>(ai);
+        }
+        return nullptr;
+    }
+    
+    // Діапазон ще не зіграних партій одного потоку
+    struct alignas(64) WorkRange {
+        std::mutex mutex;
+        long long begin = 0;
+        long long end = 0;
+    };
+    
+    // Планувальник з крадіжкою роботи над блоками [0, total)
+    class WorkStealingScheduler {
+    private:
+        std::vector<std::unique_ptr<WorkRange>> ranges;
+        
+        // Забрати половину (з кінця) діапазону іншого потоку
+        bool steal(int thief, long long& begin, long long& end) {
+            int count = static_cast<int>(ranges.size());
+            for (int i = 1; i < count; i++) {
+                WorkRange& victim = *ranges[(thief + i) % count];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                
+                long long left = victim.end - victim.begin;
+                if (left <= 0) continue;
+                
+                long long taken = (left + 1) / 2;
+                begin = victim.end - taken;
+                end = victim.end;
+                victim.end = begin;
+                return true;
+            }
+            return false;
+        }
+        
+    public:
+        WorkStealingScheduler(long long total, int workers) {
+            for (int worker = 0; worker < workers; worker++) {
+                std::unique_ptr<WorkRange> range(new WorkRange());
+                range->begin = total * worker / workers;
+                range->end = total * (worker + 1) / workers;
+                ranges.push_back(std::move(range));
+            }
+        }
+        
+        // Наступний блок для потоку worker. false - роботи більше немає
+        bool next(int worker, long long& block) {
+            WorkRange& own = *ranges[worker];
+            
+            for (;;) {
+                {
+                    std::lock_guard<std::mutex> lock(own.mutex);
+                    if (own.begin < own.end) {
+                        block = own.begin++;
+                        return true;
+                    }
+                }
+                
+                // Свій діапазон закінчився - крадемо і кладемо вкрадене собі
+                long long stolenBegin, stolenEnd;
+                if (!steal(worker, stolenBegin, stolenEnd)) {
+                    return false;
+                }
+                
+                std::lock_guard<std::mutex> lock(own.mutex);
+                own.begin = stolenBegin;
+                own.end = stolenEnd;
+            }
+        }
+    };
+    
+    // Статистика одного потоку
+    struct SimStats {
+        long long games = 0;
+        long long aborted = 0;
+        long long wins[SEATS] = {0, 0};
+        long long winsMovingFirst[SEATS] = {0, 0};
+        
+        // Кількість пострілів переможця: скільки партій AI виграв за n пострілів
+        std::array<long long, Board::CELLS + 1> winningShots[SEATS];
+        
+        SimStats() {
+            for (std::array<long long, Board::CELLS + 1>& histogram : winningShots) {
+                histogram.fill(0);
+            }
+        }
+        
+        void merge(const SimStats& other) {
+            games += other.games;
+            aborted += other.aborted;
+            for (int ai = 0; ai < SEATS; ai++) {
+                wins[ai] += other.wins[ai];
+                winsMovingFirst[ai] += other.winsMovingFirst[ai];
+                for (int shots = 0; shots <= Board::CELLS; shots++) {
+                    winningShots[ai][shots] += other.winningShots[ai][shots];
+                }
+            }
+        }
+    };
+    
+    // Місце для однієї партії блоку. AI створюються один раз і скидаються
+    // перед кожною партією
+    struct GameSlot {
+        std::unique_ptr<AIPlayer> players[SEATS];   // У порядку командного рядка
+        PluginAI* plugins[SEATS] = {nullptr, nullptr};   // Ті самі AI, якщо це плагіни
+        std::unique_ptr<GameEngine> game;
+        int first = 0;                               // Який AI ходить першим
+        
+        // AI, чий зараз хід
+        int shooter() const {
+            return game->getCurrentSeat() == 0 ? first : 1 - first;
+        }
+    };
+    
+    // Розставити кораблі для партії номер index
+    void startGame(GameSlot& slot, long long index, uint64_t seed) {
+        uint64_t state = seed ^ (static_cast<uint64_t>(index) * 0x9E3779B97F4A7C15ULL);
+        
+        // Зерно до reset: AI плагіна створюється в reset і бере зерно з rng
+        for (int ai = 0; ai < SEATS; ai++) {
+            slot.players[ai]->setSeed(static_cast<std::mt19937::result_type>(Zobrist::splitMix64(state)));
+            slot.players[ai]->reset();
+        }
+        
+        // Непарні партії першим ходить другий AI
+        slot.first = static_cast<int>(index % SEATS);
+        slot.game.reset(new GameEngine(*slot.players[slot.first], *slot.players[1 - slot.first]));
+        slot.game->setPace(Pace::HEADLESS);
+        slot.game->setMoveTime(0, slot.players[slot.first]->getMoveTime());
+        slot.game->setMoveTime(1, slot.players[1 - slot.first]->getMoveTime());
+        
+        slot.game->placeShips();
+    }
+    
+    void recordGame(const GameSlot& slot, SimStats& stats) {
+        int winnerSeat = slot.game->getWinner();
+        
+        stats.games++;
+        if (winnerSeat < 0) {
+            stats.aborted++;
+            return;
+        }
+        
+        int winner = winnerSeat == 0 ? slot.first : 1 - slot.first;
+        int shots = std::min(slot.players[winner]->getShotsCount(), Board::CELLS);
+        stats.wins[winner]++;
+        stats.winningShots[winner][shots]++;
+        if (winnerSeat == 0) {
+            stats.winsMovingFirst[winner]++;
+        }
+    }
+    
+    // Партії [begin, end) по slots.size() одночасно, хід за ходом. Позиції всіх
+    // партій, де зараз хід AI-плагіна, йдуть йому одним викликом chooseTargets
+    void playBlock(std::vector<GameSlot>& slots, long long begin, long long end, uint64_t seed,
+                   SimStats& stats) {
+        const Board* trackings[BATCH];
+        Coordinate targets[BATCH];
+        PluginAI* shooters[BATCH];
+        
+        for (long long from = begin; from < end; from += static_cast<long long>(slots.size())) {
+            int count = static_cast<int>(std::min(static_cast<long long>(slots.size()), end - from));
+            for (int i = 0; i < count; i++) {
+                startGame(slots[i], from + i, seed);
+            }
+            
+            bool playing = true;
+            while (playing) {
+                for (int ai = 0; ai < SEATS; ai++) {
+                    int batch = 0;
+                    for (int i = 0; i < count; i++) {
+                        GameSlot& slot = slots[i];
+                        if (slot.plugins[ai] && !slot.game->isOver() && slot.shooter() == ai) {
+                            shooters[batch] = slot.plugins[ai];
+                            trackings[batch] = &slot.plugins[ai]->getTrackingBoard();
+                            batch++;
+                        }
+                    }
+                    if (batch == 0) continue;
+                    
+                    // Позиція передається повністю, тож відповідати за всі партії
+                    // може AI плагіна будь-якої з них. Без відповіді партія
+                    // спитає плагін сама
+                    int answered = shooters[0]->chooseTargets(trackings, batch, targets);
+                    for (int j = 0; j < answered; j++) {
+                        shooters[j]->setBatchTarget(targets[j]);
+                    }
+                }
+                
+                playing = false;
+                for (int i = 0; i < count; i++) {
+                    if (slots[i].game->playTurn()) {
+                        playing = true;
+                    }
+                }
+            }
+            
+            for (int i = 0; i < count; i++) {
+                recordGame(slots[i], stats);
+            }
+        }
+    }
+    
+    // Найменша кількість пострілів, за яку виграно частку fraction партій
+    int percentile(const std::array<long long, Board::CELLS + 1>& histogram, long long total, double fraction) {
+        long long rank = static_cast<long long>(fraction * (total - 1));
+        long long seen = 0;
+        for (int shots = 0; shots <= Board::CELLS; shots++) {
+            seen += histogram[shots];
+            if (seen > rank) return shots;
+        }
+        return Board::CELLS;
+    }
+    
+    void report(const std::string kinds[SEATS], const SimStats& stats, double seconds) {
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "\nЗіграно " << stats.games << " партій за " << seconds << " с ("
+                  << stats.games / std::max(seconds, 1e-9) << " партій/с)\n";
+        if (stats.aborted > 0) {
+            std::cout << "Перервано: " << stats.aborted << "\n";
+        }
+        
+        for (int ai = 0; ai < SEATS; ai++) {
+            long long wins = stats.wins[ai];
+            // Першим цей AI ходив у парних партіях, якщо він перший, і навпаки
+            long long movedFirst = ai == 0 ? (stats.games + 1) / 2 : stats.games / 2;
+            
+            std::cout << "\n" << kinds[ai] << " (AI " << ai + 1 << ")\n";
+            std::cout << "  перемог: " << wins << " (" << 100.0 * wins / std::max(stats.games, 1LL) << "%)";
+            if (movedFirst > 0) {
+                std::cout << ", ходячи першим: " << 100.0 * stats.winsMovingFirst[ai] / movedFirst << "%";
+            }
+            std::cout << "\n";
+            
+            if (wins == 0) continue;
+            
+            const std::array<long long, Board::CELLS + 1>& histogram = stats.winningShots[ai];
+            long long total = 0;
+            for (int shots = 0; shots <= Board::CELLS; shots++) {
+                total += static_cast<long long>(shots) * histogram[shots];
+            }
+            
+            std::cout << "  пострілів до перемоги: в середньому " << static_cast<double>(total) / wins
+                      << ", мін " << percentile(histogram, wins, 0.0)
+                      << ", p10 " << percentile(histogram, wins, 0.1)
+                      << ", p50 " << percentile(histogram, wins, 0.5)
+                      << ", p90 " << percentile(histogram, wins, 0.9)
+                      << ", макс " << percentile(histogram, wins, 1.0) << "\n";
+            
+            // Розподіл по 10 пострілів
+            std::cout << "  розподіл:";
+            for (int from = 0; from <= Board::CELLS; from += 10) {
+                long long count = 0;
+                for (int shots = from; shots < from + 10 && shots <= Board::CELLS; shots++) {
+                    count += histogram[shots];
+                }
+                if (count > 0) {
+                    std::cout << " " << from << "-" << std::min(from + 9, Board::CELLS) << ": "
+                              << 100.0 * count / wins << "%";
+                }
+            }
+            std::cout << "\n";
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    long long games = argc > 1 ? std::atoll(argv[1]) : 100000;
+    std::string kinds[SEATS] = {argc > 2 ? argv[2] : "smart", argc > 3 ? argv[3] : "random"};
+    int threads = argc > 4 ? std::atoi(argv[4]) : 0;
+    uint64_t seed = argc > 5 ? std::strtoull(argv[5], nullptr, 10) : std::random_device()();
+    
+    // 0 - за кількістю ядер процесора
+    if (threads <= 0) threads = static_cast<int>(std::thread::hardware_concurrency());
+    if (threads <= 0) threads = 1;
+    
+    // Бібліотеки плагінів завантажуються один раз для всіх потоків
+    std::shared_ptr<PluginLibrary> libraries[SEATS];
+    bool usesPlugins = false;
+    for (int ai = 0; ai < SEATS; ai++) {
+        if (kinds[ai].compare(0, PLUGIN_PREFIX.size(), PLUGIN_PREFIX) != 0) continue;
+        
+        libraries[ai] = std::make_shared<PluginLibrary>();
+        if (!libraries[ai]->open(kinds[ai].substr(PLUGIN_PREFIX.size()))) {
+            std::cerr << libraries[ai]->getLastError() << "\n";
+            return 1;
+        }
+        if (!createAI(kinds[ai], libraries[ai])) {
+            std::cerr << libraries[ai]->getName() << ": plugin does not support these rules\n";
+            return 1;
+        }
+        usesPlugins = true;
+    }
+    
+    if (games <= 0 || !createAI(kinds[0], libraries[0]) || !createAI(kinds[1], libraries[1])) {
+        std::cerr << "Використання: " << argv[0] << " [партій] [AI 1] [AI 2] [потоків] [зерно]\n";
+        std::cerr << "AI: random, smart, smart-density, density, montecarlo, plugin:<шлях>\n";
+        return 1;
+    }
+    
+    std::cout << kinds[0] << " проти " << kinds[1] << ": " << games << " партій, "
+              << threads << " потоків, зерно " << seed << "\n";
+    
+    WorkStealingScheduler scheduler((games + BATCH - 1) / BATCH, threads);
+    std::vector<SimStats> workerStats(threads);
+    std::atomic<long long> played(0);
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < threads; worker++) {
+        workers.emplace_back([&, worker] {
+            SimStats& stats = workerStats[worker];
+            
+            // Без плагінів партії блоку йдуть по одній
+            std::vector<GameSlot> slots(usesPlugins ? BATCH : 1);
+            for (GameSlot& slot : slots) {
+                for (int ai = 0; ai < SEATS; ai++) {
+                    slot.players[ai] = createAI(kinds[ai], libraries[ai]);
+                    slot.players[ai]->setPace(Pace::HEADLESS);
+                    if (libraries[ai]) {
+                        slot.plugins[ai] = static_cast<PluginAI*>(slot.players[ai].get());
+                    }
+                }
+            }
+            
+            long long block;
+            while (scheduler.next(worker, block)) {
+                long long begin = block * BATCH;
+                long long end = std::min(games, begin + BATCH);
+                playBlock(slots, begin, end, seed, stats);
+                played.fetch_add(end - begin, std::memory_order_relaxed);
+            }
+        });
+    }
+    
+    // Поступ раз на секунду, поки потоки грають
+    std::thread progress([&] {
+        long long lastReported = 0;
+        while (played.load() < games) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (seconds >= lastReported + 1) {
+                lastReported = static_cast<long long>(seconds);
+                long long done = played.load();
+                std::cerr << "  зіграно: " << done << " (" << static_cast<long long>(done / seconds)
+                          << " партій/с)\r" << std::flush;
+            }
+        }
+    });
+    
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    progress.join();
+    
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    SimStats total;
+    for (const SimStats& stats : workerStats) {
+        total.merge(stats);
+    }
+    
+    report(kinds, total, seconds);
+    return 0;
+}
\ No newline at end of file
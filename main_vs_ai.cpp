@@ -2,8 +2,12 @@
 #include "board.h"
 #include "player.h"
 #include "ai.h"
+#include "plugin_ai.h"
+#include "game_engine.h"
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 // Функції UI (декларації)
 void clearScreen();
@@ -15,15 +19,122 @@ bool askPlayAgain();
 void displayMatchStats(const Player& player1, const Player& player2);
 void displayTurnInfo(const std::string& playerName, int turnNumber);
 void showLoadingAnimation(const std::string& message, int duration);
+void displayShotResult(ShotResult result);
+
+// Консольний вигляд гри проти AI (людина - місце 0, AI - місце 1)
+class VsAIConsoleView : public GameObserver {
+private:
+    static const int HUMAN = 0;
+    
+public:
+    void onPlacementStarted(const GameEngine& game, int seat) override {
+        const Player& player = game.getPlayer(seat);
+        
+        if (seat == HUMAN) {
+            std::cout << Color::YELLOW << "═══════════════════════════════════════\n";
+            std::cout << "  " << player.getName() << ", підготуйтесь!\n";
+            std::cout << "═══════════════════════════════════════\n" << Color::RESET;
+            pause();
+            clearScreen();
+        } else {
+            clearScreen();
+            showLoadingAnimation(player.getName() + " розміщує свої кораблі", 3);
+        }
+    }
+    
+    void onShipsPlaced(const GameEngine&, int seat) override {
+        if (seat == HUMAN) {
+            std::cout << "\n" << Color::GREEN << "Ваші кораблі розміщено!\n" << Color::RESET;
+            pause();
+        }
+    }
+    
+    void onTurnStarted(const GameEngine& game, int seat) override {
+        const Player& player = game.getPlayer(seat);
+        
+        clearScreen();
+        displayTurnInfo(player.getName(), game.getTurnNumber());
+        
+        if (seat == HUMAN) {
+            // Показуємо дошки гравця
+            player.displayBothBoards();
+        } else {
+            std::cout << Color::YELLOW << player.getName() << " думає...\n" << Color::RESET;
+        }
+    }
+    
+    void onInvalidShot(const GameEngine&, int seat, const Coordinate& target) override {
+        if (seat != HUMAN) {
+            return;
+        }
+        
+        if (!target.isValid()) {
+            std::cout << Color::RED << "Неправильні координати! Спробуйте ще раз.\n" << Color::RESET;
+        } else {
+            displayShotResult(SHOT_INVALID);
+        }
+    }
+    
+    void onShot(const GameEngine& game, int seat, const Coordinate& target, ShotResult result) override {
+        const Player& human = game.getPlayer(HUMAN);
+        
+        if (seat == HUMAN) {
+            displayShotResult(result);
+            
+            // Показуємо оновлену дошку
+            std::cout << "\n";
+            human.displayTrackingBoard();
+        } else {
+            std::cout << Color::YELLOW << game.getPlayer(seat).getName() << " стріляє по "
+                      << char('A' + target.row) << target.col << "\n" << Color::RESET;
+            displayShotResult(result);
+            
+            // Показуємо вашу дошку після пострілу AI
+            std::cout << "\nВаша дошка після пострілу AI:\n";
+            human.displayOwnBoard();
+        }
+        
+        if (result != SHOT_WIN) {
+            pause();
+        }
+    }
+    
+    void onGameOver(const GameEngine& game, int winner) override {
+        const Player& human = game.getPlayer(HUMAN);
+        const Player& ai = game.getPlayer(GameEngine::opponentOf(HUMAN));
+        
+        pause();
+        displayVictory(game.getPlayer(winner).getName());
+        
+        // Показуємо статистику
+        displayMatchStats(human, ai);
+        
+        // Показуємо фінальні дошки
+        std::cout << Color::CYAN << "\nФінальний стан:\n" << Color::RESET;
+        std::cout << "\nВаші кораблі:\n";
+        human.displayOwnBoard();
+        
+        std::cout << "\nКораблі AI:\n";
+        ai.getOwnBoard().display(false);
+    }
+};
 
 // Вибір складності AI
-int selectAIDifficulty() {
+int selectAIDifficulty(const std::vector<std::shared_ptr<PluginLibrary>>& plugins) {
     clearScreen();
     printTitle();
     
     std::cout << Color::YELLOW << "Виберіть складність AI:\n" << Color::RESET;
     std::cout << "  1. " << Color::GREEN << "Простий AI" << Color::RESET << " - випадкові постріли\n";
     std::cout << "  2. " << Color::RED << "Розумний AI" << Color::RESET << " - стратегічні постріли\n";
+    std::cout << "  3. " << Color::CYAN << "Імовірнісний AI" << Color::RESET << " - постріли за густиною кораблів\n";
+    std::cout << "  4. " << Color::BLUE << "Монте-Карло AI" << Color::RESET << " - моделює тисячі розстановок\n";
+    
+    // Плагіни з каталогу plugins - пункти 5, 6, ...
+    for (size_t i = 0; i < plugins.size(); i++) {
+        std::cout << "  " << i + 5 << ". " << Color::YELLOW << plugins[i]->getName() << Color::RESET
+                  << " - плагін " << plugins[i]->getPath() << "\n";
+    }
     std::cout << "\nВаш вибір: ";
     
     int choice;
@@ -33,9 +144,9 @@ int selectAIDifficulty() {
     return choice;
 }
 
-void playVsAI() {
+void playVsAI(OpponentModel& opponents, const std::vector<std::shared_ptr<PluginLibrary>>& plugins) {
     // Вибір складності
-    int difficulty = selectAIDifficulty();
+    int difficulty = selectAIDifficulty(plugins);
     
     // Створюємо гравця
     Player human;
@@ -50,31 +161,55 @@ void playVsAI() {
     human.setName(name);
     
     // Створюємо AI відповідної складності
-    AIPlayer* ai;
-    if (difficulty == 2) {
-        ai = new SmartAI("🤖 Розумний AI");
-    } else {
-        ai = new RandomAI("🤖 Простий AI");
+    AIPlayer* ai = nullptr;
+    if (difficulty >= 5 && difficulty - 5 < static_cast<int>(plugins.size())) {
+        PluginAI* pluginAI = new PluginAI(plugins[difficulty - 5]);
+        if (pluginAI->isReady()) {
+            ai = pluginAI;
+        } else {
+            std::cerr << pluginAI->getName() << ": plugin does not support these rules\n";
+            delete pluginAI;
+        }
     }
     
-    clearScreen();
+    if (!ai) {
+        if (difficulty == 4) {
+            ai = new MonteCarloAI("🤖 Монте-Карло AI");
+        } else if (difficulty == 3) {
+            ai = new DensityAI("🤖 Імовірнісний AI");
+        } else if (difficulty == 2) {
+            ai = new SmartAI("🤖 Розумний AI");
+        } else {
+            ai = new RandomAI("🤖 Простий AI");
+        }
+        
+        // Людина не помітить кількох мілісекунд на хід - граємо кінець гри точно
+        ai->setEndgameThreshold(EndgameSolver::RECOMMENDED_MAX_LAYOUTS);
+    }
     
-    // Людина розміщує кораблі
-    std::cout << Color::YELLOW << "═══════════════════════════════════════\n";
-    std::cout << "  " << human.getName() << ", підготуйтесь!\n";
-    std::cout << "═══════════════════════════════════════\n" << Color::RESET;
-    pause();
-    clearScreen();
+    // Книга дебютів, якщо її побудовано (main_book_builder.cpp)
+    std::shared_ptr<OpeningBook> book = std::make_shared<OpeningBook>();
+    if (book->open("opening_book.bin")) {
+        ai->setOpeningBook(book);
+    }
     
-    human.placeShips();
+    // Що AI пам'ятає про цього гравця з попередніх ігор
+    ai->setOpponent(opponents, human.getName());
     
-    std::cout << "\n" << Color::GREEN << "Ваші кораблі розміщено!\n" << Color::RESET;
-    pause();
+    // Бібліотека розстановок (main_placement_builder.cpp)
+    std::shared_ptr<PlacementLibrary> library = std::make_shared<PlacementLibrary>();
+    if (library->load("placement_library.bin")) {
+        ai->setPlacementLibrary(library);
+    }
+    
+    // Людина - місце 0 і ходить першою
+    GameEngine game(human, *ai);
+    game.setMoveTime(1, ai->getMoveTime());
+    VsAIConsoleView view;
+    game.addObserver(view);
     
-    // AI розміщує кораблі
     clearScreen();
-    showLoadingAnimation(ai->getName() + " розміщує свої кораблі", 3);
-    ai->placeShips();
+    game.placeShips();
     
     // Початок гри
     clearScreen();
@@ -91,122 +226,12 @@ void playVsAI() {
     pause();
     
     // Основний ігровий цикл
-    int turnNumber = 1;
-    bool gameOver = false;
-    bool humanTurn = true;  // Людина ходить першою
+    game.play();
     
-    while (!gameOver) {
-        clearScreen();
-        
-        if (humanTurn) {
-            // ХІД ЛЮДИНИ
-            displayTurnInfo(human.getName(), turnNumber);
-            
-            // Показуємо дошки гравця
-            human.displayBothBoards();
-            
-            // Гравець робить постріл
-            bool validShot = false;
-            Coordinate target;
-            ShotResult result;
-            
-            while (!validShot) {
-                target = human.chooseTarget();
-                
-                if (!target.isValid()) {
-                    std::cout << Color::RED << "Неправильні координати! Спробуйте ще раз.\n" << Color::RESET;
-                    continue;
-                }
-                
-                // Робимо постріл по AI
-                result = ai->receiveShot(target);
-                
-                if (result == SHOT_INVALID) {
-                    continue;
-                }
-                
-                validShot = true;
-            }
-            
-            // Обробляємо результат пострілу
-            human.processShotResult(target, result);
-            
-            // Показуємо оновлену дошку
-            std::cout << "\n";
-            human.displayTrackingBoard();
-            
-            // Перевіряємо чи гра закінчена
-            if (result == SHOT_WIN) {
-                gameOver = true;
-                
-                pause();
-                displayVictory(human.getName());
-                
-                // Показуємо статистику
-                displayMatchStats(human, *ai);
-                
-                // Показуємо фінальні дошки
-                std::cout << Color::CYAN << "\nФінальний стан:\n" << Color::RESET;
-                std::cout << "\nВаші кораблі:\n";
-                human.displayOwnBoard();
-                
-                std::cout << "\nКораблі AI:\n";
-                ai->getOwnBoard().display(false);
-                
-            } else {
-                pause();
-                humanTurn = false;
-            }
-            
-        } else {
-            // ХІД AI
-            displayTurnInfo(ai->getName(), turnNumber);
-            
-            std::cout << Color::YELLOW << ai->getName() << " думає...\n" << Color::RESET;
-            
-            // AI вибирає ціль
-            Coordinate target = ai->chooseTarget();
-            
-            // AI робить постріл
-            ShotResult result = human.receiveShot(target);
-            
-            // AI обробляє результат (тільки для SmartAI)
-            SmartAI* smartAI = dynamic_cast<SmartAI*>(ai);
-            if (smartAI) {
-                smartAI->updateAfterShot(target, result);
-            }
-            
-            // Оновлюємо tracking board AI
-            ai->processShotResult(target, result);
-            
-            // Показуємо вашу дошку після пострілу AI
-            std::cout << "\nВаша дошка після пострілу AI:\n";
-            human.displayOwnBoard();
-            
-            // Перевіряємо чи гра закінчена
-            if (result == SHOT_WIN) {
-                gameOver = true;
-                
-                pause();
-                displayVictory(ai->getName());
-                
-                // Показуємо статистику
-                displayMatchStats(human, *ai);
-                
-                // Показуємо фінальні дошки
-                std::cout << Color::CYAN << "\nФінальний стан:\n" << Color::RESET;
-                std::cout << "\nВаші кораблі:\n";
-                human.displayOwnBoard();
-                
-                std::cout << "\nКораблі AI:\n";
-                ai->getOwnBoard().display(false);
-                
-            } else {
-                pause();
-                humanTurn = true;
-                turnNumber++;
-            }
-        }
+    // Запам'ятовуємо, як гравець розставив кораблі - лише для партій, зіграних
+    // до кінця (перервана партія могла закінчитись ще до розстановки)
+    if (game.getWinner() >= 0) {
+        opponents.recordGame(human.getName(), human.getOwnBoard());
     }
     
     delete ai;
@@ -218,6 +243,19 @@ int main() {
         system("chcp 65001 > nul");
     #endif
     
+    // Модель суперників завантажується один раз на весь сеанс
+    OpponentModel opponents("opponents.dat");
+    if (!opponents.load()) {
+        std::cerr << opponents.getLastError() << "\n";
+    }
+    
+    // AI-плагіни (seabattle_plugin.h)
+    std::vector<std::string> pluginErrors;
+    std::vector<std::shared_ptr<PluginLibrary>> plugins = PluginLibrary::loadDirectory("plugins", &pluginErrors);
+    for (const std::string& error : pluginErrors) {
+        std::cerr << error << "\n";
+    }
+    
     bool keepPlaying = true;
     
     while (keepPlaying) {
@@ -233,7 +271,7 @@ int main() {
         }
         
         // Запускаємо гру
-        playVsAI();
+        playVsAI(opponents, plugins);
         
         // Питаємо чи хочуть грати ще раз
         keepPlaying = askPlayAgain();
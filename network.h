@@ -2,6 +2,8 @@
 #define NETWORK_H
 
 #include "common.h"
+#include "player.h"
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -193,6 +195,33 @@ public:
     bool receiveChatMessage(std::string& message);
     
     std::string getName() const { return name; }
+    
+    bool isConnected() const { return network->isConnected(); }
+};
+
+// Суперник по мережі як гравець GameEngine: його постріли приходять з мережі,
+// а наші постріли по ньому відправляються туди ж і чекають результату
+class RemotePlayer : public Player {
+private:
+    NetworkPlayer& link;
+    
+public:
+    RemotePlayer(const std::string& playerName, NetworkPlayer& networkLink);
+    
+    // Суперник розставляє кораблі на своєму комп'ютері
+    void placeShips() override {}
+    
+    // Постріл суперника; (-1, -1), якщо його не вдалося отримати
+    using Player::chooseTarget;
+    Coordinate chooseTarget() override;
+    
+    // Наш постріл по суперникові; результат рахує його сторона
+    ShotResult receiveShot(const Coordinate& coord) override;
+    
+    // Повідомляємо суперникові результат його пострілу
+    void processShotResult(const Coordinate& coord, ShotResult result) override;
+    
+    bool hasLeft() const override { return !link.isConnected(); }
 };
 
 #endif // NETWORK_H
\ No newline at end of file
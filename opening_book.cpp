@@ -0,0 +1,211 @@
+#include "opening_book.h"
+#include "board.h"
+#include "zobrist.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+    const char BOOK_MAGIC[8] = "SBBOOK1";
+
+    static_assert(Board::CELLS <= 256, "Постріл у книзі зберігається одним байтом");
+    static_assert(sizeof(OpeningBook::Header) % 8 == 0, "Хеші мають бути вирівняні");
+}
+
+// ==================== OpeningBook ====================
+
+OpeningBook::OpeningBook()
+    : data(nullptr), dataSize(0), hashes(nullptr), cells(nullptr), entryCount(0) {
+#ifdef _WIN32
+    fileHandle = nullptr;
+    mappingHandle = nullptr;
+#endif
+}
+
+OpeningBook::~OpeningBook() {
+    close();
+}
+
+uint64_t OpeningBook::fingerprint() {
+    uint64_t state = 0;
+    uint64_t result = Zobrist::splitMix64(state);
+
+    auto mix = [&](uint64_t value) {
+        state ^= value;
+        result ^= Zobrist::splitMix64(state);
+    };
+
+    mix(StandardGeometry::ROWS);
+    mix(StandardGeometry::COLS);
+    for (ShipType type : StandardGeometry::FLEET) {
+        mix(static_cast<uint64_t>(type));
+    }
+
+    // Книга дійсна лише з тими самими ключами хешування
+    mix(Zobrist::KEYS<Board::CELLS>.miss[0]);
+    mix(Zobrist::KEYS<Board::CELLS>.hit[Board::CELLS - 1]);
+    return result;
+}
+
+bool OpeningBook::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        lastError = "Cannot open " + path;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(Header))) {
+        CloseHandle(file);
+        lastError = "Opening book is too small: " + path;
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        lastError = "Cannot map " + path;
+        return false;
+    }
+
+    fileHandle = file;
+    mappingHandle = mapping;
+    dataSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        lastError = "Cannot open " + path;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(Header))) {
+        ::close(fd);
+        lastError = "Opening book is too small: " + path;
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    // Відображення тримає файл саме, дескриптор більше не потрібен
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        lastError = "Cannot map " + path;
+        return false;
+    }
+
+    dataSize = static_cast<size_t>(info.st_size);
+#endif
+
+    data = static_cast<const unsigned char*>(view);
+
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, BOOK_MAGIC, sizeof(BOOK_MAGIC)) != 0) {
+        close();
+        lastError = "Not an opening book: " + path;
+        return false;
+    }
+
+    if (header.fingerprint != fingerprint()) {
+        close();
+        lastError = "Opening book was built for different rules: " + path;
+        return false;
+    }
+
+    // Кількість записів береться з файлу, тож перевіряємо її до множення,
+    // інакше добуток може переповнитись і пройти перевірку розміру
+    const size_t entrySize = sizeof(uint64_t) + sizeof(uint8_t);
+    if (header.entryCount > (dataSize - sizeof(Header)) / entrySize ||
+        dataSize != sizeof(Header) + static_cast<size_t>(header.entryCount) * entrySize) {
+        close();
+        lastError = "Opening book is truncated: " + path;
+        return false;
+    }
+
+    // Заголовок кратний 8 байтам, тож хеші вирівняні
+    entryCount = static_cast<size_t>(header.entryCount);
+    hashes = reinterpret_cast<const uint64_t*>(data + sizeof(Header));
+    cells = data + sizeof(Header) + entryCount * sizeof(uint64_t);
+    return true;
+}
+
+void OpeningBook::close() {
+    if (data) {
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+        CloseHandle(static_cast<HANDLE>(fileHandle));
+        mappingHandle = nullptr;
+        fileHandle = nullptr;
+#else
+        munmap(const_cast<unsigned char*>(data), dataSize);
+#endif
+    }
+
+    data = nullptr;
+    dataSize = 0;
+    hashes = nullptr;
+    cells = nullptr;
+    entryCount = 0;
+}
+
+bool OpeningBook::lookup(uint64_t hash, Coordinate& target) const {
+    if (!data) {
+        return false;
+    }
+
+    const uint64_t* found = std::lower_bound(hashes, hashes + entryCount, hash);
+    if (found == hashes + entryCount || *found != hash) {
+        return false;
+    }
+
+    int cell = cells[found - hashes];
+    target = Coordinate(cell / Board::COLS, cell % Board::COLS);
+    return true;
+}
+
+bool OpeningBook::write(const std::string& path, std::vector<std::pair<uint64_t, int>> entries) {
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end(),
+                              [](const std::pair<uint64_t, int>& a, const std::pair<uint64_t, int>& b) {
+                                  return a.first == b.first;
+                              }),
+                  entries.end());
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(header.magic, BOOK_MAGIC, sizeof(BOOK_MAGIC));
+    header.fingerprint = fingerprint();
+    header.entryCount = entries.size();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const std::pair<uint64_t, int>& entry : entries) {
+        out.write(reinterpret_cast<const char*>(&entry.first), sizeof(entry.first));
+    }
+    for (const std::pair<uint64_t, int>& entry : entries) {
+        uint8_t cell = static_cast<uint8_t>(entry.second);
+        out.write(reinterpret_cast<const char*>(&cell), sizeof(cell));
+    }
+
+    return static_cast<bool>(out);
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef OPENING_BOOK_H
+#define OPENING_BOOK_H
+
+#include "common.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Книга дебютів: найкращий постріл для позицій початку гри.
+//
+// Перші постріли залежать лише від складу флоту та результатів попередніх
+// пострілів, тому їх можна порахувати заздалегідь найсильнішим AI
+// (main_book_builder.cpp) і записати у файл. Ключ позиції - Zobrist-хеш
+// tracking board. Файл відкривається лише для читання через mmap
+// (MapViewOfFile на Windows), тож кілька процесів ділять ті самі сторінки.
+//
+// Формат файлу (little-endian):
+//   Header                - див. нижче
+//   uint64_t hashes[n]    - хеші позицій за зростанням
+//   uint8_t  cells[n]     - постріл для позиції (row * COLS + col)
+class OpeningBook {
+public:
+    struct Header {
+        char magic[8];         // "SBBOOK1"
+        uint64_t fingerprint;  // Розміри дошки, флот та ключі Zobrist
+        uint64_t entryCount;
+    };
+
+private:
+    const unsigned char* data;
+    size_t dataSize;
+    const uint64_t* hashes;
+    const uint8_t* cells;
+    size_t entryCount;
+    std::string lastError;
+
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+
+public:
+    OpeningBook();
+    ~OpeningBook();
+
+    OpeningBook(const OpeningBook&) = delete;
+    OpeningBook& operator=(const OpeningBook&) = delete;
+
+    // Відкрити файл книги; false - файлу немає або він не для цієї гри
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return data != nullptr; }
+    size_t size() const { return entryCount; }
+    std::string getLastError() const { return lastError; }
+
+    // Постріл для позиції з хешем hash, якщо він є в книзі
+    bool lookup(uint64_t hash, Coordinate& target) const;
+
+    // Відбиток поточних правил гри (StandardGeometry та ключі Zobrist)
+    static uint64_t fingerprint();
+
+    // Записати книгу: пари (хеш позиції, клітинка пострілу) у довільному порядку
+    static bool write(const std::string& path, std::vector<std::pair<uint64_t, int>> entries);
+};
+
+#endif // OPENING_BOOK_H
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include "opponent_model.h"
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+namespace {
+    const char MODEL_MAGIC[6] = {'S', 'B', 'O', 'P', 'P', '1'};
+    const size_t HEADER_BYTES = sizeof(MODEL_MAGIC) + 2 * sizeof(uint16_t);
+    const size_t MASK_BYTES = (Board::CELLS + 7) / 8;
+    const size_t MAX_NAME_LENGTH = 255;
+
+    // Частка клітинок дошки, зайнятих флотом
+    double shipCellShare() {
+        int cells = 0;
+        for (ShipType type : StandardGeometry::FLEET) {
+            cells += static_cast<int>(type);
+        }
+        return static_cast<double>(cells) / Board::CELLS;
+    }
+
+    void writeHeader(std::ofstream& out) {
+        uint16_t rows = Board::ROWS;
+        uint16_t cols = Board::COLS;
+        out.write(MODEL_MAGIC, sizeof(MODEL_MAGIC));
+        out.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+        out.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
+    }
+
+    void writeRecordStart(std::ofstream& out, OpponentModel::RecordType type, const std::string& name) {
+        uint8_t header[2] = {static_cast<uint8_t>(type), static_cast<uint8_t>(name.size())};
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        out.write(name.data(), name.size());
+    }
+
+    std::string recordName(const std::string& opponent) {
+        return opponent.substr(0, MAX_NAME_LENGTH);
+    }
+}
+
+// ==================== OpponentModel ====================
+
+OpponentModel::OpponentModel(const std::string& filePath)
+    : path(filePath), journalRecords(0) {
+}
+
+bool OpponentModel::load() {
+    heatmaps.clear();
+    journal.close();
+    journalRecords = 0;
+
+    if (path.empty()) {
+        return true;
+    }
+
+    // Файлу ще немає - він з'явиться з першим записом
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return true;
+    }
+
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (bytes.empty()) {
+        return true;
+    }
+
+    uint16_t rows = 0;
+    uint16_t cols = 0;
+    if (bytes.size() >= HEADER_BYTES) {
+        std::memcpy(&rows, &bytes[sizeof(MODEL_MAGIC)], sizeof(rows));
+        std::memcpy(&cols, &bytes[sizeof(MODEL_MAGIC) + sizeof(rows)], sizeof(cols));
+    }
+    if (bytes.size() < HEADER_BYTES || std::memcmp(bytes.data(), MODEL_MAGIC, sizeof(MODEL_MAGIC)) != 0 ||
+        rows != Board::ROWS || cols != Board::COLS) {
+        lastError = "Not an opponent model for this board: " + path;
+        return false;
+    }
+
+    size_t pos = HEADER_BYTES;
+    bool damaged = false;
+
+    while (pos < bytes.size()) {
+        if (bytes.size() - pos < 2) {
+            damaged = true;
+            break;
+        }
+
+        uint8_t type = static_cast<uint8_t>(bytes[pos]);
+        size_t nameLength = static_cast<uint8_t>(bytes[pos + 1]);
+        size_t payload = type == RECORD_GAME ? MASK_BYTES
+                       : type == RECORD_HEATMAP ? sizeof(uint32_t) * (1 + Board::CELLS) : 0;
+
+        // Невідомий тип або обірваний запис (наприклад, збій посеред дописування)
+        if (payload == 0 || bytes.size() - pos - 2 < nameLength + payload) {
+            damaged = true;
+            break;
+        }
+
+        std::string name(&bytes[pos + 2], nameLength);
+        const char* data = &bytes[pos + 2 + nameLength];
+        pos += 2 + nameLength + payload;
+
+        auto inserted = heatmaps.emplace(name, Heatmap());
+        Heatmap& heatmap = inserted.first->second;
+        if (inserted.second) {
+            heatmap.games = 0;
+            heatmap.shipCells.fill(0);
+        }
+
+        if (type == RECORD_GAME) {
+            heatmap.games++;
+            for (int cell = 0; cell < Board::CELLS; cell++) {
+                if (data[cell / 8] & (1 << (cell % 8))) {
+                    heatmap.shipCells[cell]++;
+                }
+            }
+            journalRecords++;
+        } else {
+            uint32_t values[1 + Board::CELLS];
+            std::memcpy(values, data, sizeof(values));
+            heatmap.games += values[0];
+            for (int cell = 0; cell < Board::CELLS; cell++) {
+                heatmap.shipCells[cell] += values[1 + cell];
+            }
+        }
+    }
+
+    // Пошкоджений хвіст відкидаємо, інакше нові записи опинились би після нього
+    if (damaged) {
+        return compact();
+    }
+    return true;
+}
+
+bool OpponentModel::openJournal() {
+    std::ifstream existing(path, std::ios::binary | std::ios::ate);
+    bool fresh = !existing || existing.tellg() <= 0;
+    existing.close();
+
+    journal.open(path, std::ios::binary | std::ios::app);
+    if (!journal) {
+        lastError = "Cannot open " + path;
+        return false;
+    }
+
+    if (fresh) {
+        writeHeader(journal);
+    }
+    return static_cast<bool>(journal);
+}
+
+bool OpponentModel::recordGame(const std::string& opponent, const Board& revealed) {
+    std::string name = recordName(opponent);
+    const Board::Mask& ships = revealed.getShipMask();
+
+    auto inserted = heatmaps.emplace(name, Heatmap());
+    Heatmap& heatmap = inserted.first->second;
+    if (inserted.second) {
+        heatmap.games = 0;
+        heatmap.shipCells.fill(0);
+    }
+
+    uint8_t mask[MASK_BYTES] = {};
+    heatmap.games++;
+    ships.forEachSet([&](int cell) {
+        heatmap.shipCells[cell]++;
+        mask[cell / 8] |= static_cast<uint8_t>(1 << (cell % 8));
+    });
+
+    if (path.empty()) {
+        return true;
+    }
+
+    if (!journal.is_open() && !openJournal()) {
+        return false;
+    }
+
+    writeRecordStart(journal, RECORD_GAME, name);
+    journal.write(reinterpret_cast<const char*>(mask), sizeof(mask));
+    journal.flush();
+    if (!journal) {
+        lastError = "Cannot write " + path;
+        return false;
+    }
+
+    if (++journalRecords >= COMPACT_AFTER) {
+        return compact();
+    }
+    return true;
+}
+
+bool OpponentModel::compact() {
+    if (path.empty()) {
+        return true;
+    }
+
+    journal.close();
+
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            lastError = "Cannot write " + temporary;
+            return false;
+        }
+
+        writeHeader(out);
+        for (const auto& entry : heatmaps) {
+            uint32_t values[1 + Board::CELLS];
+            values[0] = entry.second.games;
+            std::copy(entry.second.shipCells.begin(), entry.second.shipCells.end(), values + 1);
+
+            writeRecordStart(out, RECORD_HEATMAP, entry.first);
+            out.write(reinterpret_cast<const char*>(values), sizeof(values));
+        }
+
+        if (!out) {
+            lastError = "Cannot write " + temporary;
+            return false;
+        }
+    }
+
+    // На Windows rename не замінює наявний файл. На POSIX rename замінює його
+    // атомарно, і старий файл не можна видаляти заздалегідь
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        lastError = "Cannot replace " + path;
+        return false;
+    }
+
+    journalRecords = 0;
+    return true;
+}
+
+const OpponentModel::Heatmap* OpponentModel::find(const std::string& opponent) const {
+    auto found = heatmaps.find(recordName(opponent));
+    return found == heatmaps.end() ? nullptr : &found->second;
+}
+
+bool OpponentModel::prior(const std::string& opponent, Prior& factors) const {
+    factors.fill(1.0f);
+
+    const Heatmap* heatmap = find(opponent);
+    if (!heatmap || heatmap->games == 0) {
+        return false;
+    }
+
+    // Згладжена частота: до ігор додаються PRIOR_STRENGTH ігор із середньою частотою
+    double share = shipCellShare();
+    double games = heatmap->games + PRIOR_STRENGTH;
+    for (int cell = 0; cell < Board::CELLS; cell++) {
+        double frequency = (heatmap->shipCells[cell] + PRIOR_STRENGTH * share) / games;
+        factors[cell] = static_cast<float>(frequency / share);
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#ifndef OPPONENT_MODEL_H
+#define OPPONENT_MODEL_H
+
+#include "common.h"
+#include "board.h"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+// Модель суперників: для кожного суперника - як часто в кожній клітинці
+// стояли його кораблі в попередніх іграх.
+//
+// Після гри розстановку суперника (getOwnBoard()) дописують у журнал одним
+// коротким записом, тож запис займає мікросекунди. Під час завантаження
+// журнал зводиться в теплові карти; коли в ньому накопичується багато
+// записів, файл переписується зведеними картами (compact).
+//
+// Формат файлу: заголовок "SBOPP1", ROWS, COLS, далі записи
+//   uint8 тип, uint8 довжина імені, ім'я, дані:
+//     RECORD_GAME    - маска клітинок кораблів, (CELLS + 7) / 8 байтів
+//     RECORD_HEATMAP - uint32 кількість ігор, uint32 лічильники[CELLS]
+class OpponentModel {
+public:
+    struct Heatmap {
+        uint32_t games;
+        std::array<uint32_t, Board::CELLS> shipCells;
+    };
+
+    typedef std::array<float, Board::CELLS> Prior;
+
+    enum RecordType {
+        RECORD_GAME = 1,
+        RECORD_HEATMAP = 2
+    };
+
+private:
+    std::string path;
+    std::unordered_map<std::string, Heatmap> heatmaps;
+    std::ofstream journal;
+    int journalRecords;  // Записів ігор після останнього compact
+    std::string lastError;
+
+    bool openJournal();
+
+public:
+    // Записи ігор у журналі, після яких файл зводиться
+    static const int COMPACT_AFTER = 1024;
+
+    // Скільки "уявних" ігор з рівномірним розподілом додається до статистики:
+    // чим менше ігор із суперником, тим слабший вплив його карти
+    static const int PRIOR_STRENGTH = 20;
+
+    // Порожній path - модель лише в пам'яті
+    explicit OpponentModel(const std::string& filePath = "");
+
+    // Прочитати файл; відсутній файл - порожня модель
+    bool load();
+
+    // Врахувати розстановку суперника після гри
+    bool recordGame(const std::string& opponent, const Board& revealed);
+
+    // Переписати файл зведеними тепловими картами
+    bool compact();
+
+    const Heatmap* find(const std::string& opponent) const;
+    std::string getLastError() const { return lastError; }
+
+    // Множники для клітинок: у скільки разів корабель суперника там імовірніший
+    // за середнє (1 - немає даних). false, якщо суперника ще не бачили
+    bool prior(const std::string& opponent, Prior& factors) const;
+};
+
+#endif // OPPONENT_MODEL_H
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "placement_library.h"
+#include "placement_table.h"
+#include "zobrist.h"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    const char LIBRARY_MAGIC[8] = "SBPLIB1";
+
+    // Віддзеркалення розстановки: рядки та/або стовпчики у зворотному порядку
+    Coordinate mirrored(const Board::Placement& p, bool flipRows, bool flipCols) {
+        int lastRow = p.orientation == VERTICAL ? p.start.row + p.size - 1 : p.start.row;
+        int lastCol = p.orientation == HORIZONTAL ? p.start.col + p.size - 1 : p.start.col;
+
+        return Coordinate(flipRows ? Board::ROWS - 1 - lastRow : p.start.row,
+                          flipCols ? Board::COLS - 1 - lastCol : p.start.col);
+    }
+}
+
+// ==================== PlacementLibrary ====================
+
+uint64_t PlacementLibrary::fingerprint() {
+    uint64_t state = 0;
+    uint64_t result = Zobrist::splitMix64(state);
+
+    auto mix = [&](uint64_t value) {
+        state ^= value;
+        result ^= Zobrist::splitMix64(state);
+    };
+
+    mix(StandardGeometry::ROWS);
+    mix(StandardGeometry::COLS);
+    for (ShipType type : StandardGeometry::FLEET) {
+        mix(static_cast<uint64_t>(type));
+    }
+    return result;
+}
+
+void PlacementLibrary::buildAliasTable() {
+    size_t n = weights.size();
+    probability.assign(n, 1.0f);
+    alias.resize(n);
+
+    double total = 0.0;
+    for (float weight : weights) {
+        total += weight;
+    }
+
+    // Масштабуємо ваги так, щоб середня дорівнювала 1, і ділимо на "малі" та "великі"
+    std::vector<double> scaled(n);
+    std::vector<uint32_t> small;
+    std::vector<uint32_t> large;
+
+    for (size_t i = 0; i < n; i++) {
+        alias[i] = static_cast<uint32_t>(i);
+        scaled[i] = total > 0.0 ? weights[i] * n / total : 1.0;
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+    }
+
+    // Кожен малий стовпчик доповнюємо шматком великого
+    while (!small.empty() && !large.empty()) {
+        uint32_t less = small.back();
+        small.pop_back();
+        uint32_t more = large.back();
+
+        probability[less] = static_cast<float>(scaled[less]);
+        alias[less] = more;
+
+        scaled[more] -= 1.0 - scaled[less];
+        if (scaled[more] < 1.0) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    // Залишки через похибки округлення - повні стовпчики
+    for (uint32_t i : small) probability[i] = 1.0f;
+    for (uint32_t i : large) probability[i] = 1.0f;
+}
+
+bool PlacementLibrary::assign(const std::vector<Layout>& newLayouts, const std::vector<float>& newWeights) {
+    if (newLayouts.size() != newWeights.size()) {
+        lastError = "Layout and weight counts differ";
+        return false;
+    }
+
+    for (float weight : newWeights) {
+        if (!std::isfinite(weight) || weight < 0.0f) {
+            lastError = "Layout weight is negative, infinite or NaN";
+            return false;
+        }
+    }
+
+    layouts = newLayouts;
+    weights = newWeights;
+    buildAliasTable();
+    return true;
+}
+
+bool PlacementLibrary::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        lastError = "Cannot open " + path;
+        return false;
+    }
+
+    Header header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, LIBRARY_MAGIC, sizeof(LIBRARY_MAGIC)) != 0) {
+        lastError = "Not a placement library: " + path;
+        return false;
+    }
+
+    if (header.fingerprint != fingerprint() || header.shipsPerLayout != StandardGeometry::FLEET_SIZE) {
+        lastError = "Placement library was built for different rules: " + path;
+        return false;
+    }
+
+    // Кількість розстановок береться з файлу, тож до виділення пам'яті
+    // перевіряємо, що дані справді такого розміру
+    std::streamoff dataStart = in.tellg();
+    in.seekg(0, std::ios::end);
+    std::streamoff dataSize = in.tellg() - dataStart;
+    in.seekg(dataStart);
+    if (!in || dataSize < 0 ||
+        static_cast<uint64_t>(dataSize) != uint64_t(header.layoutCount) * (sizeof(Layout) + sizeof(float))) {
+        lastError = "Placement library is truncated: " + path;
+        return false;
+    }
+
+    std::vector<Layout> newLayouts(header.layoutCount);
+    std::vector<float> newWeights(header.layoutCount);
+
+    in.read(reinterpret_cast<char*>(newLayouts.data()), newLayouts.size() * sizeof(Layout));
+    in.read(reinterpret_cast<char*>(newWeights.data()), newWeights.size() * sizeof(float));
+    if (!in) {
+        lastError = "Placement library is truncated: " + path;
+        return false;
+    }
+
+    // Індекси позицій мають відповідати розмірам кораблів флоту
+    for (const Layout& layout : newLayouts) {
+        for (int s = 0; s < StandardGeometry::FLEET_SIZE; s++) {
+            if (layout.ships[s] >= PlacementTable::TOTAL<StandardGeometry> ||
+                PlacementTable::ENTRIES<StandardGeometry>[layout.ships[s]].size !=
+                    static_cast<int>(StandardGeometry::FLEET[s])) {
+                lastError = "Placement library is corrupted: " + path;
+                return false;
+            }
+        }
+    }
+
+    return assign(newLayouts, newWeights);
+}
+
+bool PlacementLibrary::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(header.magic, LIBRARY_MAGIC, sizeof(LIBRARY_MAGIC));
+    header.fingerprint = fingerprint();
+    header.layoutCount = static_cast<uint32_t>(layouts.size());
+    header.shipsPerLayout = StandardGeometry::FLEET_SIZE;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(layouts.data()), layouts.size() * sizeof(Layout));
+    out.write(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(float));
+    return static_cast<bool>(out);
+}
+
+bool PlacementLibrary::place(Board& board, std::mt19937& gen) const {
+    if (layouts.empty()) {
+        return false;
+    }
+
+    // Стовпчик таблиці аліасів і "монетка" всередині нього
+    std::uniform_int_distribution<uint32_t> column(0, static_cast<uint32_t>(layouts.size() - 1));
+    std::uniform_real_distribution<float> coin(0.0f, 1.0f);
+    uint32_t index = column(gen);
+    if (coin(gen) >= probability[index]) {
+        index = alias[index];
+    }
+
+    unsigned flips = gen();
+    bool flipRows = flips & 1;
+    bool flipCols = flips & 2;
+
+    board.clear();
+    for (uint16_t placement : layouts[index].ships) {
+        const Board::Placement& p = PlacementTable::ENTRIES<StandardGeometry>[placement];
+        if (!board.placeShip(static_cast<ShipType>(p.size), mirrored(p, flipRows, flipCols), p.orientation)) {
+            board.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PlacementLibrary::fromBoard(const Board& board, Layout& layout) {
+    const std::vector<Ship>& ships = board.getShips();
+    if (static_cast<int>(ships.size()) != StandardGeometry::FLEET_SIZE) {
+        return false;
+    }
+
+    // Кораблі записуємо в порядку флоту, щоб розміри збігались з FLEET
+    bool used[StandardGeometry::FLEET_SIZE] = {};
+    for (int s = 0; s < StandardGeometry::FLEET_SIZE; s++) {
+        int size = static_cast<int>(StandardGeometry::FLEET[s]);
+        int found = -1;
+        for (int i = 0; i < StandardGeometry::FLEET_SIZE && found < 0; i++) {
+            if (!used[i] && ships[i].size == size) found = i;
+        }
+        if (found < 0) {
+            return false;
+        }
+
+        used[found] = true;
+        int index = PlacementTable::indexOf<StandardGeometry>(size, ships[found].start, ships[found].orientation);
+        if (index < 0) {
+            return false;
+        }
+        layout.ships[s] = static_cast<uint16_t>(index);
+    }
+    return true;
+}
\ No newline at end of file
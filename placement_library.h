@@ -0,0 +1,71 @@
+#ifndef PLACEMENT_LIBRARY_H
+#define PLACEMENT_LIBRARY_H
+
+#include "common.h"
+#include "board.h"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// Бібліотека розстановок флоту, які важко знайти.
+//
+// Розстановки та їх ваги рахує офлайн-генератор (main_placement_builder.cpp),
+// граючи наших AI проти кожного кандидата. Під час гри розстановка
+// вибирається за O(1) через таблицю аліасів (метод Вокера - Воуза) і
+// випадково віддзеркалюється, щоб суперник не вивчив конкретні позиції.
+//
+// Формат файлу (little-endian):
+//   Header                        - див. нижче
+//   uint16_t ships[n][FLEET_SIZE] - індекси позицій у PlacementTable
+//   float    weights[n]           - ваги розстановок
+class PlacementLibrary {
+public:
+    struct Header {
+        char magic[8];          // "SBPLIB1"
+        uint64_t fingerprint;   // Розміри дошки та флот
+        uint32_t layoutCount;
+        uint32_t shipsPerLayout;
+    };
+
+    // Одна розстановка: позиції кораблів у PlacementTable
+    struct Layout {
+        uint16_t ships[StandardGeometry::FLEET_SIZE];
+    };
+
+private:
+    std::vector<Layout> layouts;
+    std::vector<float> weights;
+
+    // Таблиця аліасів: стовпчик i вибирає i з імовірністю probability[i], інакше alias[i]
+    std::vector<float> probability;
+    std::vector<uint32_t> alias;
+
+    std::string lastError;
+
+    void buildAliasTable();
+
+public:
+    bool load(const std::string& path);
+
+    // Задати розстановки напряму (генератор, тести). Ваги мають бути скінченними
+    // і невід'ємними - інакше таблиця аліасів не має сенсу (load перевіряє так само)
+    bool assign(const std::vector<Layout>& newLayouts, const std::vector<float>& newWeights);
+
+    bool save(const std::string& path) const;
+
+    bool empty() const { return layouts.empty(); }
+    size_t size() const { return layouts.size(); }
+    std::string getLastError() const { return lastError; }
+
+    // Розставити на board випадкову розстановку з бібліотеки
+    bool place(Board& board, std::mt19937& gen) const;
+
+    // Розстановка з кораблів дошки; false, якщо флот не стандартний
+    static bool fromBoard(const Board& board, Layout& layout);
+
+    // Відбиток поточних правил гри
+    static uint64_t fingerprint();
+};
+
+#endif // PLACEMENT_LIBRARY_H
\ No newline at end of file
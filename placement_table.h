@@ -0,0 +1,139 @@
+#ifndef PLACEMENT_TABLE_H
+#define PLACEMENT_TABLE_H
+
+#include "common.h"
+#include "bitboard.h"
+#include <array>
+
+// Одна можлива позиція корабля на порожній дошці
+template <typename Geometry>
+struct BasicPlacement {
+    typedef BitBoard<Geometry::CELLS> Mask;
+
+    Coordinate start;
+    Orientation orientation;
+    int size;
+    Mask footprint;  // Клітинки корабля
+    Mask halo;       // Клітинки корабля разом з усіма сусідніми (зона без інших кораблів)
+
+    constexpr BasicPlacement() : orientation(HORIZONTAL), size(0) {}
+};
+
+typedef BasicPlacement<StandardGeometry> Placement;
+
+// Таблиця всіх позицій кораблів кожного розміру, побудована під час компіляції.
+// Позиції одного розміру лежать поспіль: спочатку горизонтальні (рядок за рядком),
+// потім вертикальні, тому індекс позиції обчислюється без пошуку.
+// Для кожної геометрії будується своя таблиця.
+namespace PlacementTable {
+    // Кількість горизонтальних позицій корабля заданого розміру
+    template <typename Geometry>
+    constexpr int horizontalCount(int size) {
+        return size <= Geometry::COLS ? Geometry::ROWS * (Geometry::COLS - size + 1) : 0;
+    }
+
+    // Кількість вертикальних позицій (для розміру 1 орієнтації збігаються)
+    template <typename Geometry>
+    constexpr int verticalCount(int size) {
+        if (size == 1 || size > Geometry::ROWS) return 0;
+        return (Geometry::ROWS - size + 1) * Geometry::COLS;
+    }
+
+    template <typename Geometry>
+    constexpr int countFor(int size) {
+        return horizontalCount<Geometry>(size) + verticalCount<Geometry>(size);
+    }
+
+    // Зміщення першої позиції заданого розміру в таблиці
+    template <typename Geometry>
+    constexpr int offsetFor(int size) {
+        int offset = 0;
+        for (int s = 1; s < size; s++) {
+            offset += countFor<Geometry>(s);
+        }
+        return offset;
+    }
+
+    template <typename Geometry>
+    inline constexpr int TOTAL = offsetFor<Geometry>(Geometry::MAX_SHIP_SIZE + 1);
+
+    template <typename Geometry>
+    constexpr BasicPlacement<Geometry> makePlacement(int size, Coordinate start, Orientation orientation) {
+        BasicPlacement<Geometry> p;
+        p.start = start;
+        p.orientation = orientation;
+        p.size = size;
+
+        for (int i = 0; i < size; i++) {
+            int row = orientation == HORIZONTAL ? start.row : start.row + i;
+            int col = orientation == HORIZONTAL ? start.col + i : start.col;
+            p.footprint.set(row * Geometry::COLS + col);
+
+            for (int dr = -1; dr <= 1; dr++) {
+                for (int dc = -1; dc <= 1; dc++) {
+                    Coordinate neighbour(row + dr, col + dc);
+                    if (neighbour.isValidIn<Geometry>()) {
+                        p.halo.set(neighbour.row * Geometry::COLS + neighbour.col);
+                    }
+                }
+            }
+        }
+        return p;
+    }
+
+    template <typename Geometry>
+    constexpr std::array<BasicPlacement<Geometry>, TOTAL<Geometry>> build() {
+        std::array<BasicPlacement<Geometry>, TOTAL<Geometry>> table;
+        int index = 0;
+
+        for (int size = 1; size <= Geometry::MAX_SHIP_SIZE; size++) {
+            for (int row = 0; row < Geometry::ROWS; row++) {
+                for (int col = 0; col + size <= Geometry::COLS; col++) {
+                    table[index++] = makePlacement<Geometry>(size, Coordinate(row, col), HORIZONTAL);
+                }
+            }
+
+            if (size == 1) continue;
+
+            for (int row = 0; row + size <= Geometry::ROWS; row++) {
+                for (int col = 0; col < Geometry::COLS; col++) {
+                    table[index++] = makePlacement<Geometry>(size, Coordinate(row, col), VERTICAL);
+                }
+            }
+        }
+        return table;
+    }
+
+    template <typename Geometry>
+    inline constexpr std::array<BasicPlacement<Geometry>, TOTAL<Geometry>> ENTRIES = build<Geometry>();
+
+    // Перша та наступна за останньою позиції заданого розміру
+    template <typename Geometry>
+    inline const BasicPlacement<Geometry>* begin(int size) {
+        return ENTRIES<Geometry>.data() + offsetFor<Geometry>(size);
+    }
+
+    template <typename Geometry>
+    inline const BasicPlacement<Geometry>* end(int size) {
+        return ENTRIES<Geometry>.data() + offsetFor<Geometry>(size + 1);
+    }
+
+    // Індекс позиції в таблиці або -1, якщо корабель виходить за межі дошки
+    template <typename Geometry>
+    constexpr int indexOf(int size, Coordinate start, Orientation orientation) {
+        if (size < 1 || size > Geometry::MAX_SHIP_SIZE || !start.isValidIn<Geometry>()) {
+            return -1;
+        }
+
+        if (orientation == HORIZONTAL || size == 1) {
+            if (start.col + size > Geometry::COLS) return -1;
+            return offsetFor<Geometry>(size) + start.row * (Geometry::COLS - size + 1) + start.col;
+        }
+
+        if (start.row + size > Geometry::ROWS) return -1;
+        return offsetFor<Geometry>(size) + horizontalCount<Geometry>(size)
+               + start.row * Geometry::COLS + start.col;
+    }
+}
+
+#endif // PLACEMENT_TABLE_H
\ No newline at end of file
@@ -29,10 +29,12 @@ void Player::placeShips() {
     
     // Перевіряємо чи користувач хоче автоматичне розміщення
     if (input == "auto" || input == "AUTO" || input == "а" || input == "Auto") {
-        ownBoard.placeShipsRandomly();
-        std::cout << Color::GREEN << "Кораблі розміщено автоматично!\n" << Color::RESET;
-        displayOwnBoard();
-        return;
+        if (ownBoard.placeShipsRandomly()) {
+            std::cout << Color::GREEN << "Кораблі розміщено автоматично!\n" << Color::RESET;
+            displayOwnBoard();
+            return;
+        }
+        std::cout << Color::RED << "Не вдалося розмістити кораблі автоматично. Розмістіть їх вручну.\n" << Color::RESET;
     }
     
     // Ручне розміщення
@@ -139,6 +141,10 @@ Coordinate Player::chooseTarget() {
     return Coordinate(row, col);
 }
 
+Coordinate Player::chooseTarget(MoveClock::time_point, Pace) {
+    return chooseTarget();
+}
+
 ShotResult Player::receiveShot(const Coordinate& coord) {
     return ownBoard.shoot(coord);
 }
@@ -150,32 +156,19 @@ void Player::processShotResult(const Coordinate& coord, ShotResult result) {
     switch (result) {
         case SHOT_MISS:
             // Маркуємо як промах на tracking board
-            trackingBoard.shoot(coord);
-            std::cout << Color::GRAY << "Промах!\n" << Color::RESET;
+            trackingBoard.recordShot(coord, result);
             break;
             
         case SHOT_HIT:
-            hitsCount++;
-            // Маркуємо як влучання на tracking board
-            trackingBoard.shoot(coord);
-            std::cout << Color::YELLOW << "Влучання!\n" << Color::RESET;
-            break;
-            
         case SHOT_SUNK:
-            hitsCount++;
-            trackingBoard.shoot(coord);
-            std::cout << Color::RED << "Корабель потоплено!\n" << Color::RESET;
-            break;
-            
         case SHOT_WIN:
             hitsCount++;
-            trackingBoard.shoot(coord);
-            std::cout << Color::GREEN << "Всі кораблі противника знищено! Перемога!\n" << Color::RESET;
+            // Маркуємо як влучання на tracking board
+            trackingBoard.recordShot(coord, result);
             break;
             
         case SHOT_INVALID:
             shotsCount--; // Не рахуємо невалідний постріл
-            std::cout << Color::RED << "Ви вже стріляли сюди! Спробуйте інші координати.\n" << Color::RESET;
             break;
     }
 }
@@ -3,8 +3,18 @@
 
 #include "common.h"
 #include "board.h"
+#include <chrono>
 #include <string>
 
+// Монотонний годинник для дедлайнів ходу
+typedef std::chrono::steady_clock MoveClock;
+
+// Темп ходу
+enum class Pace {
+    HEADLESS,     // Без затримок: симуляції, сервер, тести
+    INTERACTIVE   // З паузою "на роздуми" для гри з людиною
+};
+
 class Player {
 protected:
     std::string name;
@@ -32,17 +42,28 @@ public:
     
     // Розміщення кораблів
     virtual void placeShips();
-    void placeShipsRandomly() { ownBoard.placeShipsRandomly(); }
+    bool placeShipsRandomly() { return ownBoard.placeShipsRandomly(); }
     bool placeShip(ShipType type, Coordinate start, Orientation orientation);
     
     // Вибір координат для пострілу (віртуальний метод для AI)
     virtual Coordinate chooseTarget();
     
+    // Вибір цілі до deadline у заданому темпі. Людина дедлайн ігнорує
+    virtual Coordinate chooseTarget(MoveClock::time_point deadline, Pace pace);
+    
     // Отримання пострілу від противника
-    ShotResult receiveShot(const Coordinate& coord);
+    virtual ShotResult receiveShot(const Coordinate& coord);
+    
+    // Обробка результату власного пострілу (без виводу - його робить
+    // спостерігач GameEngine)
+    virtual void processShotResult(const Coordinate& coord, ShotResult result);
+    
+    // Гравець вийшов з гри (наприклад, розірвалось мережеве з'єднання)
+    virtual bool hasLeft() const { return false; }
     
-    // Обробка результату власного пострілу
-    void processShotResult(const Coordinate& coord, ShotResult result);
+    // Ходи робить людина (локально чи через мережу). Неправильний постріл
+    // вона просто повторює, тож ліміт GameEngine::MAX_INVALID_SHOTS її не стосується
+    virtual bool isInteractive() const { return true; }
     
     // Перевірка програшу
     bool hasLost() const { return ownBoard.allShipsSunk(); }
@@ -58,8 +79,9 @@ public:
     void displayTrackingBoard() const;
     void displayBothBoards() const;
     
-    // Скидання статистики
-    void reset();
+    // Нова гра: порожні дошки та статистика. AI скидають і свій стан,
+    // тож один об'єкт можна використати для багатьох партій
+    virtual void reset();
     
     // Вивід статистики
     void displayStats() const;
@@ -0,0 +1,292 @@
+#include "plugin_ai.h"
+#include <algorithm>
+#include <filesystem>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <dlfcn.h>
+#endif
+
+namespace {
+#if defined(_WIN32)
+    const char* PLUGIN_EXTENSION = ".dll";
+#elif defined(__APPLE__)
+    const char* PLUGIN_EXTENSION = ".dylib";
+#else
+    const char* PLUGIN_EXTENSION = ".so";
+#endif
+
+    void* loadSymbol(void* handle, const char* name) {
+#ifdef _WIN32
+        return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(handle), name));
+#else
+        return dlsym(handle, name);
+#endif
+    }
+
+    SbObservation observation(const Coordinate& coord, ShotResult result) {
+        SbObservation observed;
+        observed.shot.row = coord.row;
+        observed.shot.col = coord.col;
+        switch (result) {
+            case SHOT_HIT:  observed.result = SB_RESULT_HIT; break;
+            case SHOT_SUNK: observed.result = SB_RESULT_SUNK; break;
+            case SHOT_WIN:  observed.result = SB_RESULT_WIN; break;
+            default:        observed.result = SB_RESULT_MISS; break;
+        }
+        return observed;
+    }
+}
+
+// ==================== PluginLibrary ====================
+
+PluginLibrary::PluginLibrary() : handle(nullptr), api(nullptr) {
+}
+
+PluginLibrary::~PluginLibrary() {
+    close();
+}
+
+bool PluginLibrary::open(const std::string& libraryPath) {
+    close();
+    path = libraryPath;
+
+#ifdef _WIN32
+    handle = LoadLibraryA(path.c_str());
+    if (!handle) {
+        lastError = "Cannot load " + path;
+        return false;
+    }
+#else
+    handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        const char* error = dlerror();
+        lastError = error ? error : "Cannot load " + path;
+        return false;
+    }
+#endif
+
+    SbPluginEntry entry = reinterpret_cast<SbPluginEntry>(loadSymbol(handle, SB_PLUGIN_ENTRY_NAME));
+    const SbPluginApi* table = entry ? entry() : nullptr;
+
+    if (!table) {
+        lastError = path + ": no " SB_PLUGIN_ENTRY_NAME;
+    } else if (table->abiVersion != SB_PLUGIN_ABI_VERSION) {
+        lastError = path + ": unsupported plugin ABI version " + std::to_string(table->abiVersion);
+    } else if (!table->init || !table->chooseTargets || !table->destroy) {
+        lastError = path + ": plugin API is incomplete";
+    } else {
+        api = table;
+        return true;
+    }
+
+    close();
+    return false;
+}
+
+void PluginLibrary::close() {
+    if (handle) {
+#ifdef _WIN32
+        FreeLibrary(static_cast<HMODULE>(handle));
+#else
+        dlclose(handle);
+#endif
+    }
+    handle = nullptr;
+    api = nullptr;
+}
+
+std::string PluginLibrary::getName() const {
+    if (api && api->name) {
+        return api->name;
+    }
+    return std::filesystem::path(path).stem().string();
+}
+
+std::vector<std::shared_ptr<PluginLibrary>> PluginLibrary::loadDirectory(const std::string& directory,
+                                                                        std::vector<std::string>* errors) {
+    std::vector<std::shared_ptr<PluginLibrary>> plugins;
+
+    std::error_code error;
+    std::filesystem::directory_iterator entries(directory, error);
+    if (error) {
+        return plugins;
+    }
+
+    std::vector<std::string> paths;
+    for (const std::filesystem::directory_entry& entry : entries) {
+        if (entry.is_regular_file(error) && entry.path().extension() == PLUGIN_EXTENSION) {
+            paths.push_back(entry.path().string());
+        }
+    }
+
+    // Порядок плагінів не залежить від файлової системи
+    std::sort(paths.begin(), paths.end());
+
+    for (const std::string& pluginPath : paths) {
+        std::shared_ptr<PluginLibrary> plugin = std::make_shared<PluginLibrary>();
+        if (plugin->open(pluginPath)) {
+            plugins.push_back(plugin);
+        } else if (errors) {
+            errors->push_back(plugin->getLastError());
+        }
+    }
+    return plugins;
+}
+
+// ==================== PluginAI ====================
+
+PluginAI::PluginAI(std::shared_ptr<PluginLibrary> pluginLibrary, const std::string& aiName)
+    : AIPlayer(aiName), library(pluginLibrary), instance(nullptr), batchTarget(-1, -1) {
+    if (!library || !library->isOpen()) {
+        return;
+    }
+
+    if (aiName.empty()) {
+        name = library->getName();
+    }
+
+    createInstance();
+}
+
+PluginAI::~PluginAI() {
+    if (instance) {
+        library->getApi()->destroy(instance);
+    }
+}
+
+void PluginAI::reset() {
+    AIPlayer::reset();
+    batchTarget = Coordinate(-1, -1);
+
+    if (instance) {
+        library->getApi()->destroy(instance);
+        instance = nullptr;
+    }
+    if (library && library->isOpen()) {
+        createInstance();
+    }
+}
+
+void PluginAI::setError(const std::string& message) {
+    lastError = library ? library->getPath() + ": " + message : message;
+}
+
+void PluginAI::createInstance() {
+    int32_t shipSizes[StandardGeometry::FLEET_SIZE];
+    for (int i = 0; i < StandardGeometry::FLEET_SIZE; i++) {
+        shipSizes[i] = static_cast<int32_t>(StandardGeometry::FLEET[i]);
+    }
+
+    SbRules rules;
+    rules.rows = Board::ROWS;
+    rules.cols = Board::COLS;
+    rules.fleetCount = StandardGeometry::FLEET_SIZE;
+    rules.shipSizes = shipSizes;
+    rules.seed = (static_cast<uint64_t>(rng()) << 32) | rng();
+
+    instance = library->getApi()->init(&rules);
+}
+
+void PluginAI::encodePosition(const Board& tracking, uint8_t* cells) {
+    for (int index = 0; index < Board::CELLS; index++) {
+        if (tracking.getSunkMask().test(index)) {
+            cells[index] = SB_CELL_SUNK;
+        } else if (tracking.getHitMask().test(index)) {
+            cells[index] = SB_CELL_HIT;
+        } else if (tracking.getMissMask().test(index)) {
+            cells[index] = SB_CELL_MISS;
+        } else {
+            cells[index] = SB_CELL_UNKNOWN;
+        }
+    }
+}
+
+void PluginAI::placeShips() {
+    const SbPluginApi* api = instance ? library->getApi() : nullptr;
+
+    if (api && api->placeFleet) {
+        SbShipPlacement placements[StandardGeometry::FLEET_SIZE];
+        if (api->placeFleet(instance, placements)) {
+            ownBoard.clear();
+
+            bool placed = true;
+            for (int i = 0; i < StandardGeometry::FLEET_SIZE && placed; i++) {
+                placed = ownBoard.placeShip(StandardGeometry::FLEET[i],
+                                            Coordinate(placements[i].row, placements[i].col),
+                                            placements[i].vertical ? VERTICAL : HORIZONTAL);
+            }
+
+            if (placed) {
+                return;
+            }
+            setError("plugin returned an invalid fleet");
+        }
+    }
+
+    // Плагін не вміє розставляти флот - розставляємо за нього
+    AIPlayer::placeShips();
+}
+
+Coordinate PluginAI::fallbackTarget() const {
+    Board::Mask free = trackingBoard.getAttackedMask();
+    for (int index = 0; index < Board::CELLS; index++) {
+        if (!free.test(index)) {
+            return Coordinate(index / Board::COLS, index % Board::COLS);
+        }
+    }
+    return Coordinate(-1, -1);
+}
+
+int PluginAI::chooseTargets(const Board* const* trackings, int count, Coordinate* targets) {
+    if (!instance || count <= 0) {
+        return 0;
+    }
+
+    std::vector<uint8_t> cells(static_cast<size_t>(count) * Board::CELLS);
+    std::vector<SbPosition> positions(count);
+    std::vector<SbShot> shots(count);
+
+    for (int i = 0; i < count; i++) {
+        encodePosition(*trackings[i], &cells[static_cast<size_t>(i) * Board::CELLS]);
+        positions[i].cells = &cells[static_cast<size_t>(i) * Board::CELLS];
+    }
+
+    int answered = library->getApi()->chooseTargets(instance, positions.data(), count, shots.data());
+    answered = std::max(0, std::min(answered, count));
+
+    for (int i = 0; i < answered; i++) {
+        targets[i] = Coordinate(shots[i].row, shots[i].col);
+    }
+    return answered;
+}
+
+Coordinate PluginAI::chooseTarget(MoveClock::time_point, Pace) {
+    // Постріл уже отримано пакетом разом з іншими партіями
+    Coordinate target = batchTarget;
+    batchTarget = Coordinate(-1, -1);
+
+    if (!Board::contains(target)) {
+        const Board* tracking = &trackingBoard;
+        if (chooseTargets(&tracking, 1, &target) != 1) {
+            target = Coordinate(-1, -1);
+        }
+    }
+
+    if (!Board::contains(target) || trackingBoard.isAttacked(target)) {
+        setError("plugin returned an invalid target");
+        target = fallbackTarget();
+    }
+    return target;
+}
+
+void PluginAI::processShotResult(const Coordinate& coord, ShotResult result) {
+    Player::processShotResult(coord, result);
+
+    const SbPluginApi* api = instance ? library->getApi() : nullptr;
+    if (api && api->observeResults && result != SHOT_INVALID) {
+        SbObservation observed = observation(coord, result);
+        api->observeResults(instance, &observed, 1);
+    }
+}
\ No newline at end of file
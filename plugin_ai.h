@@ -0,0 +1,96 @@
+#ifndef PLUGIN_AI_H
+#define PLUGIN_AI_H
+
+#include "ai.h"
+#include "seabattle_plugin.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// Завантажена бібліотека AI-плагіна (dlopen / LoadLibrary).
+// На Linux програму з плагінами треба лінкувати з -ldl.
+class PluginLibrary {
+private:
+    void* handle;
+    const SbPluginApi* api;
+    std::string path;
+    std::string lastError;
+
+public:
+    PluginLibrary();
+    ~PluginLibrary();
+
+    PluginLibrary(const PluginLibrary&) = delete;
+    PluginLibrary& operator=(const PluginLibrary&) = delete;
+
+    bool open(const std::string& libraryPath);
+    void close();
+
+    bool isOpen() const { return api != nullptr; }
+    const SbPluginApi* getApi() const { return api; }
+    std::string getName() const;
+    std::string getPath() const { return path; }
+    std::string getLastError() const { return lastError; }
+
+    // Усі плагіни з каталогу; помилки завантаження дописуються в errors
+    static std::vector<std::shared_ptr<PluginLibrary>> loadDirectory(const std::string& directory,
+                                                                     std::vector<std::string>* errors = nullptr);
+};
+
+// AI, який делегує рішення плагіну
+class PluginAI : public AIPlayer {
+private:
+    std::shared_ptr<PluginLibrary> library;
+    void* instance;
+    std::string lastError;
+    
+    // Постріл з пакетного виклику chooseTargets; (-1, -1) - немає
+    Coordinate batchTarget;
+
+    // Перша необстріляна клітинка, якщо плагін повернув неможливий постріл
+    Coordinate fallbackTarget() const;
+    
+    // Створити AI плагіна для нової гри за стандартними правилами
+    void createInstance();
+    
+    // Помилка з шляхом до плагіна (якщо він є)
+    void setError(const std::string& message);
+
+public:
+    // Порожнє ім'я - ім'я з плагіна
+    PluginAI(std::shared_ptr<PluginLibrary> pluginLibrary, const std::string& aiName = "");
+    ~PluginAI();
+
+    PluginAI(const PluginAI&) = delete;
+    PluginAI& operator=(const PluginAI&) = delete;
+
+    // Чи створив плагін AI для стандартних правил
+    bool isReady() const { return instance != nullptr; }
+    
+    // Остання неправильна відповідь плагіна (замість неї AI зробив хід сам)
+    std::string getLastError() const { return lastError; }
+
+    // Плагін створює AI для кожної гри заново (init після destroy).
+    // Якщо попередній init не вдався, пробуємо ще раз
+    void reset() override;
+    
+    void placeShips() override;
+    
+    // Плагін не перериває хід, тож deadline він не отримує
+    using AIPlayer::chooseTarget;
+    Coordinate chooseTarget(MoveClock::time_point deadline, Pace pace) override;
+    void processShotResult(const Coordinate& coord, ShotResult result) override;
+
+    // Постріл для кожної з count позицій за один виклик плагіна (симуляції).
+    // Повертає кількість позицій, для яких плагін дав постріл
+    int chooseTargets(const Board* const* trackings, int count, Coordinate* targets);
+    
+    // Постріл для цієї партії з пакетного chooseTargets: наступний chooseTarget
+    // поверне його (якщо він можливий) без виклику плагіна
+    void setBatchTarget(const Coordinate& target) { batchTarget = target; }
+
+    // Стан клітинок tracking board у форматі SbPosition (Board::CELLS байтів)
+    static void encodePosition(const Board& tracking, uint8_t* cells);
+};
+
+#endif // PLUGIN_AI_H
\ No newline at end of file
@@ -0,0 +1,245 @@
+/*
+ * Приклад AI-плагіна на чистому C (seabattle_plugin.h).
+ *
+ * Добиває відкриті влучання, а без них стріляє в шаховому порядку.
+ * Стану партії не зберігає - усе береться з позиції, тож chooseTargets
+ * однаково працює для однієї партії і для пакета з багатьох.
+ *
+ * Збірка:
+ *   Linux:   gcc -O2 -shared -fPIC plugin_example.c -o plugins/example.so
+ *   Windows: gcc -O2 -shared plugin_example.c -o plugins/example.dll
+ */
+
+#include "seabattle_plugin.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CELLS 1024
+#define MAX_FLEET 64
+#define PLACEMENT_ATTEMPTS 1000
+
+typedef struct ExampleAI {
+    int32_t rows;
+    int32_t cols;
+    int32_t fleetCount;
+    int32_t shipSizes[MAX_FLEET];
+    uint64_t state;             /* xorshift64 */
+} ExampleAI;
+
+static const int DR[4] = {-1, 1, 0, 0};
+static const int DC[4] = {0, 0, -1, 1};
+
+static uint64_t nextRandom(ExampleAI* ai) {
+    ai->state ^= ai->state << 13;
+    ai->state ^= ai->state >> 7;
+    ai->state ^= ai->state << 17;
+    return ai->state;
+}
+
+static int randomBelow(ExampleAI* ai, int bound) {
+    return (int)(nextRandom(ai) % (uint64_t)bound);
+}
+
+static int inside(const ExampleAI* ai, int row, int col) {
+    return row >= 0 && row < ai->rows && col >= 0 && col < ai->cols;
+}
+
+static uint8_t cellAt(const ExampleAI* ai, const uint8_t* cells, int row, int col) {
+    return inside(ai, row, col) ? cells[row * ai->cols + col] : (uint8_t)SB_CELL_MISS;
+}
+
+/* Чи може в необстріляній клітинці стояти корабель: кораблі не торкаються
+   навіть кутами, тож поруч не може бути потоплених, а по діагоналі - влучань */
+static int canHoldShip(const ExampleAI* ai, const uint8_t* cells, int row, int col) {
+    int dr, dc;
+
+    if (cellAt(ai, cells, row, col) != SB_CELL_UNKNOWN) {
+        return 0;
+    }
+    for (dr = -1; dr <= 1; dr++) {
+        for (dc = -1; dc <= 1; dc++) {
+            uint8_t cell = cellAt(ai, cells, row + dr, col + dc);
+            if (cell == SB_CELL_SUNK || (cell == SB_CELL_HIT && dr != 0 && dc != 0)) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* ==================== Вибір цілі ==================== */
+
+/* Клітинка поруч з відкритим влучанням; вздовж лінії влучань, якщо вона є */
+static int findTargetShot(const ExampleAI* ai, const uint8_t* cells, SbShot* shot) {
+    int row, col, dir;
+
+    for (row = 0; row < ai->rows; row++) {
+        for (col = 0; col < ai->cols; col++) {
+            if (cells[row * ai->cols + col] != SB_CELL_HIT) {
+                continue;
+            }
+
+            for (dir = 0; dir < 4; dir++) {
+                int step = 1;
+                if (cellAt(ai, cells, row - DR[dir], col - DC[dir]) != SB_CELL_HIT) {
+                    continue;
+                }
+                while (cellAt(ai, cells, row + DR[dir] * step, col + DC[dir] * step) == SB_CELL_HIT) {
+                    step++;
+                }
+                if (canHoldShip(ai, cells, row + DR[dir] * step, col + DC[dir] * step)) {
+                    shot->row = row + DR[dir] * step;
+                    shot->col = col + DC[dir] * step;
+                    return 1;
+                }
+            }
+
+            for (dir = 0; dir < 4; dir++) {
+                if (canHoldShip(ai, cells, row + DR[dir], col + DC[dir])) {
+                    shot->row = row + DR[dir];
+                    shot->col = col + DC[dir];
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/* Випадкова клітинка для пошуку: спершу шахові, потім будь-які можливі,
+   потім будь-які необстріляні */
+static int findHuntShot(ExampleAI* ai, const uint8_t* cells, SbShot* shot) {
+    int candidates[MAX_CELLS];
+    int pass, row, col;
+
+    for (pass = 0; pass < 3; pass++) {
+        int count = 0;
+        for (row = 0; row < ai->rows; row++) {
+            for (col = 0; col < ai->cols; col++) {
+                int suitable = pass == 2 ? cells[row * ai->cols + col] == SB_CELL_UNKNOWN
+                                         : canHoldShip(ai, cells, row, col);
+                if (suitable && (pass != 0 || (row + col) % 2 == 0)) {
+                    candidates[count++] = row * ai->cols + col;
+                }
+            }
+        }
+        if (count > 0) {
+            int index = candidates[randomBelow(ai, count)];
+            shot->row = index / ai->cols;
+            shot->col = index % ai->cols;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int32_t exampleChooseTargets(void* handle, const SbPosition* positions, int32_t count, SbShot* out) {
+    ExampleAI* ai = (ExampleAI*)handle;
+    int32_t i;
+
+    for (i = 0; i < count; i++) {
+        const uint8_t* cells = positions[i].cells;
+        if (!findTargetShot(ai, cells, &out[i]) && !findHuntShot(ai, cells, &out[i])) {
+            break;
+        }
+    }
+    return i;
+}
+
+/* ==================== Розстановка ==================== */
+
+static int32_t examplePlaceFleet(void* handle, SbShipPlacement* out) {
+    ExampleAI* ai = (ExampleAI*)handle;
+    uint8_t occupied[MAX_CELLS];
+    int attempt, ship, k, dr, dc;
+
+    for (attempt = 0; attempt < PLACEMENT_ATTEMPTS; attempt++) {
+        memset(occupied, 0, sizeof(occupied));
+
+        for (ship = 0; ship < ai->fleetCount; ship++) {
+            int size = ai->shipSizes[ship];
+            int vertical = randomBelow(ai, 2);
+            int rows = vertical ? ai->rows - size + 1 : ai->rows;
+            int cols = vertical ? ai->cols : ai->cols - size + 1;
+            int row, col, free = 1;
+
+            if (rows <= 0 || cols <= 0) {
+                return 0;
+            }
+            row = randomBelow(ai, rows);
+            col = randomBelow(ai, cols);
+
+            /* Корабель не може торкатися інших навіть кутами */
+            for (k = 0; k < size && free; k++) {
+                int r = row + (vertical ? k : 0);
+                int c = col + (vertical ? 0 : k);
+                for (dr = -1; dr <= 1; dr++) {
+                    for (dc = -1; dc <= 1; dc++) {
+                        if (inside(ai, r + dr, c + dc) && occupied[(r + dr) * ai->cols + c + dc]) {
+                            free = 0;
+                        }
+                    }
+                }
+            }
+            if (!free) {
+                break;
+            }
+
+            for (k = 0; k < size; k++) {
+                occupied[(row + (vertical ? k : 0)) * ai->cols + col + (vertical ? 0 : k)] = 1;
+            }
+            out[ship].row = row;
+            out[ship].col = col;
+            out[ship].vertical = vertical;
+        }
+
+        if (ship == ai->fleetCount) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* ==================== Точка входу ==================== */
+
+static void* exampleInit(const SbRules* rules) {
+    ExampleAI* ai;
+    int32_t i;
+
+    if (rules->rows <= 0 || rules->cols <= 0 || rules->rows * rules->cols > MAX_CELLS ||
+        rules->fleetCount < 0 || rules->fleetCount > MAX_FLEET) {
+        return NULL;
+    }
+
+    ai = (ExampleAI*)malloc(sizeof(ExampleAI));
+    if (!ai) {
+        return NULL;
+    }
+    ai->rows = rules->rows;
+    ai->cols = rules->cols;
+    ai->fleetCount = rules->fleetCount;
+    for (i = 0; i < rules->fleetCount; i++) {
+        ai->shipSizes[i] = rules->shipSizes[i];
+    }
+    /* xorshift не працює з нульовим станом */
+    ai->state = rules->seed ? rules->seed : 0x9E3779B97F4A7C15ULL;
+    return ai;
+}
+
+static void exampleDestroy(void* handle) {
+    free(handle);
+}
+
+static const SbPluginApi EXAMPLE_API = {
+    SB_PLUGIN_ABI_VERSION,
+    "Шаховий AI (плагін)",
+    exampleInit,
+    examplePlaceFleet,
+    exampleChooseTargets,
+    NULL,
+    exampleDestroy
+};
+
+SB_PLUGIN_EXPORT const SbPluginApi* sb_plugin_entry(void) {
+    return &EXAMPLE_API;
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#ifndef SEABATTLE_PLUGIN_H
+#define SEABATTLE_PLUGIN_H
+
+/*
+ * Стабільний C ABI для AI-плагінів.
+ *
+ * Плагін - спільна бібліотека (.so / .dylib / .dll), яка експортує функцію
+ * SB_PLUGIN_ENTRY_NAME, що повертає таблицю SbPluginApi. Програма порівнює
+ * abiVersion з SB_PLUGIN_ABI_VERSION і відмовляється від несумісних плагінів.
+ *
+ * Позиція передається повністю (стан кожної клітинки tracking board), тож
+ * плагін може не зберігати стан між викликами. chooseTargets приймає масив
+ * позицій і повертає по пострілу на кожну - симуляції передають десятки
+ * партій за один виклик, а не перетинають межу бібліотеки на кожен постріл.
+ *
+ * Усі структури містять лише типи фіксованого розміру; пам'ять, передана
+ * плагіну, дійсна лише під час виклику.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SB_PLUGIN_ABI_VERSION 1
+#define SB_PLUGIN_ENTRY_NAME "sb_plugin_entry"
+
+#ifdef _WIN32
+    #define SB_PLUGIN_EXPORT __declspec(dllexport)
+#else
+    #define SB_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+/* Стан клітинки tracking board */
+enum SbCell {
+    SB_CELL_UNKNOWN = 0,
+    SB_CELL_MISS = 1,
+    SB_CELL_HIT = 2,
+    SB_CELL_SUNK = 3    /* Клітинка потопленого корабля */
+};
+
+/* Результат пострілу */
+enum SbResult {
+    SB_RESULT_MISS = 0,
+    SB_RESULT_HIT = 1,
+    SB_RESULT_SUNK = 2,
+    SB_RESULT_WIN = 3
+};
+
+/* Правила гри, з якими створюється AI */
+typedef struct SbRules {
+    int32_t rows;
+    int32_t cols;
+    int32_t fleetCount;
+    const int32_t* shipSizes;   /* fleetCount розмірів кораблів */
+    uint64_t seed;              /* Зерно генератора випадкових чисел */
+} SbRules;
+
+/* Позиція: rows * cols станів клітинок SbCell, рядок за рядком */
+typedef struct SbPosition {
+    const uint8_t* cells;
+} SbPosition;
+
+typedef struct SbShot {
+    int32_t row;
+    int32_t col;
+} SbShot;
+
+/* Корабель розстановки; кораблі йдуть у порядку SbRules::shipSizes */
+typedef struct SbShipPlacement {
+    int32_t row;
+    int32_t col;
+    int32_t vertical;           /* 0 - горизонтально, 1 - вертикально */
+} SbShipPlacement;
+
+/* Результат пострілу для observeResults */
+typedef struct SbObservation {
+    SbShot shot;
+    int32_t result;             /* SbResult */
+} SbObservation;
+
+typedef struct SbPluginApi {
+    uint32_t abiVersion;        /* SB_PLUGIN_ABI_VERSION */
+    const char* name;
+
+    /* Створити AI для гри за правилами rules; NULL - правила не підтримуються */
+    void* (*init)(const SbRules* rules);
+
+    /* Розстановка флоту в out[fleetCount]; 0 - не вдалося (програма розставить сама) */
+    int32_t (*placeFleet)(void* ai, SbShipPlacement* out);
+
+    /* По пострілу для кожної з count позицій; повертає кількість заповнених out */
+    int32_t (*chooseTargets)(void* ai, const SbPosition* positions, int32_t count, SbShot* out);
+
+    /* Результати пострілів у поточній партії (необов'язково, може бути NULL) */
+    void (*observeResults)(void* ai, const SbObservation* observations, int32_t count);
+
+    void (*destroy)(void* ai);
+} SbPluginApi;
+
+typedef const SbPluginApi* (*SbPluginEntry)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SEABATTLE_PLUGIN_H */
\ No newline at end of file
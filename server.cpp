@@ -1,6 +1,7 @@
 #include "network.h"
 #include "player.h"
 #include "board.h"
+#include "game_engine.h"
 #include <iostream>
 #include <cstring>
 
@@ -10,6 +11,7 @@ void pause();
 void printTitle();
 void displayVictory(const std::string& winner);
 void displayMatchStats(const Player& player1, const Player& player2);
+void displayShotResult(ShotResult result);
 
 // ==================== NetworkManager Implementation ====================
 
@@ -304,8 +306,86 @@ bool NetworkPlayer::receiveChatMessage(std::string& message) {
     return true;
 }
 
+// ==================== RemotePlayer Implementation ====================
+
+RemotePlayer::RemotePlayer(const std::string& playerName, NetworkPlayer& networkLink)
+    : Player(playerName), link(networkLink) {
+}
+
+Coordinate RemotePlayer::chooseTarget() {
+    Coordinate target;
+    if (!link.receiveShot(target)) {
+        return Coordinate(-1, -1);
+    }
+    return target;
+}
+
+ShotResult RemotePlayer::receiveShot(const Coordinate& coord) {
+    ShotResult result;
+    if (!link.sendShot(coord) || !link.receiveResult(result)) {
+        return SHOT_INVALID;
+    }
+    return result;
+}
+
+void RemotePlayer::processShotResult(const Coordinate& coord, ShotResult result) {
+    Player::processShotResult(coord, result);
+    link.sendResult(result);
+}
+
 // ==================== Main Server Program ====================
 
+// Консольний вигляд мережевої гри з боку сервера
+class ServerConsoleView : public GameObserver {
+private:
+    int localSeat;
+    
+public:
+    explicit ServerConsoleView(int seat) : localSeat(seat) {}
+    
+    void onTurnStarted(const GameEngine& game, int seat) override {
+        clearScreen();
+        
+        if (seat == localSeat) {
+            std::cout << Color::CYAN << "=== ВАШ ХІД #" << game.getTurnNumber() << " ===\n" << Color::RESET;
+            game.getPlayer(seat).displayBothBoards();
+        } else {
+            std::cout << Color::YELLOW << "=== ХІД ПРОТИВНИКА #" << game.getTurnNumber() << " ===\n" << Color::RESET;
+            std::cout << "Очікування пострілу...\n";
+        }
+    }
+    
+    void onInvalidShot(const GameEngine&, int seat, const Coordinate&) override {
+        if (seat == localSeat) {
+            displayShotResult(SHOT_INVALID);
+        }
+    }
+    
+    void onShot(const GameEngine& game, int seat, const Coordinate& target, ShotResult result) override {
+        const Player& local = game.getPlayer(localSeat);
+        
+        if (seat == localSeat) {
+            displayShotResult(result);
+            local.displayTrackingBoard();
+        } else {
+            std::cout << "Противник стріляє по " << char('A' + target.row) << target.col << "\n";
+            local.displayOwnBoard();
+        }
+        
+        if (result != SHOT_WIN) {
+            pause();
+        }
+    }
+    
+    void onGameOver(const GameEngine& game, int winner) override {
+        displayVictory(game.getPlayer(winner).getName());
+    }
+    
+    void onGameAborted(const GameEngine&, int) override {
+        std::cout << Color::RED << "З'єднання втрачено\n" << Color::RESET;
+    }
+};
+
 void playNetworkGameAsServer() {
     GameServer server(DEFAULT_PORT);
     
@@ -353,86 +433,18 @@ void playNetworkGameAsServer() {
     std::cout << Color::GREEN << "Обидва гравці готові! Починаємо гру...\n" << Color::RESET;
     pause();
     
+    // Сервер ходить першим
+    RemotePlayer opponent("Противник", netPlayer);
+    GameEngine game(human, opponent);
+    ServerConsoleView view(0);
+    game.addObserver(view);
+    
     // Розміщуємо кораблі
     clearScreen();
-    human.placeShips();
+    game.placeShips();
     
     // Основний ігровий цикл
-    bool gameOver = false;
-    bool myTurn = true; // Сервер ходить першим
-    int turnNumber = 1;
-    
-    while (!gameOver && server.isConnected()) {
-        clearScreen();
-        
-        if (myTurn) {
-            // Наш хід
-            std::cout << Color::CYAN << "=== ВАШ ХІД #" << turnNumber << " ===\n" << Color::RESET;
-            human.displayBothBoards();
-            
-            Coordinate target = human.chooseTarget();
-            
-            // Відправляємо постріл
-            if (!netPlayer.sendShot(target)) {
-                std::cout << Color::RED << "Помилка відправки пострілу\n" << Color::RESET;
-                break;
-            }
-            
-            // Отримуємо результат
-            ShotResult result;
-            if (!netPlayer.receiveResult(result)) {
-                std::cout << Color::RED << "Помилка отримання результату\n" << Color::RESET;
-                break;
-            }
-            
-            human.processShotResult(target, result);
-            human.displayTrackingBoard();
-            
-            if (result == SHOT_WIN) {
-                gameOver = true;
-                displayVictory(human.getName());
-            } else {
-                pause();
-                myTurn = false;
-            }
-            
-        } else {
-            // Хід противника
-            std::cout << Color::YELLOW << "=== ХІД ПРОТИВНИКА #" << turnNumber << " ===\n" << Color::RESET;
-            std::cout << "Очікування пострілу...\n";
-            
-            Coordinate target;
-            if (!netPlayer.receiveShot(target)) {
-                std::cout << Color::RED << "Помилка отримання пострілу\n" << Color::RESET;
-                break;
-            }
-            
-            std::cout << "Противник стріляє по " << char('A' + target.row) << target.col << "\n";
-            
-            ShotResult result = human.receiveShot(target);
-            
-            // Відправляємо результат
-            if (!netPlayer.sendResult(result)) {
-                std::cout << Color::RED << "Помилка відправки результату\n" << Color::RESET;
-                break;
-            }
-            
-            human.displayOwnBoard();
-            
-            if (result == SHOT_WIN) {
-                gameOver = true;
-                displayVictory("Противник");
-            } else {
-                pause();
-                myTurn = true;
-                turnNumber++;
-            }
-        }
-    }
-    
-    if (!server.isConnected()) {
-        std::cout << Color::RED << "З'єднання втрачено\n" << Color::RESET;
-    }
+    game.play();
     
     pause();
     server.shutdown();
@@ -0,0 +1,227 @@
+#include "sparse_board.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+SparseBoard::SparseBoard(int rowCount, int colCount)
+    : rows(rowCount), cols(colCount), liveShips(0), totalHits(0), totalMisses(0) {
+}
+
+void SparseBoard::clear() {
+    ships.clear();
+    rowIndex.clear();
+    columnIndex.clear();
+    shots.clear();
+    liveShips = 0;
+    totalHits = 0;
+    totalMisses = 0;
+}
+
+int SparseBoard::shipOnLine(const LineTable& table, int line, int from, int to) const {
+    auto found = table.find(line);
+    if (found == table.end()) {
+        return -1;
+    }
+
+    // Останній інтервал, що починається не пізніше to; лише він може
+    // дотягнутися до from, бо кінці впорядковані так само, як початки
+    const LineIndex& intervals = found->second;
+    auto it = intervals.upper_bound(to);
+    if (it == intervals.begin()) {
+        return -1;
+    }
+    --it;
+
+    int end = it->first + ships[it->second].size - 1;
+    return end >= from ? it->second : -1;
+}
+
+int SparseBoard::shipAt(const Coordinate& coord) const {
+    int index = shipOnLine(rowIndex, coord.row, coord.col, coord.col);
+    if (index < 0) {
+        index = shipOnLine(columnIndex, coord.col, coord.row, coord.row);
+    }
+    return index;
+}
+
+bool SparseBoard::canPlaceShip(const Ship& ship) const {
+    Coordinate first = ship.start;
+    Coordinate last = ship.orientation == HORIZONTAL
+        ? Coordinate(first.row, first.col + ship.size - 1)
+        : Coordinate(first.row + ship.size - 1, first.col);
+
+    // Перевірка меж
+    if (!contains(first) || !contains(last)) {
+        return false;
+    }
+
+    // На обстріляних клітинках кораблі не ставимо
+    for (Coordinate coord : ship.cells()) {
+        if (shots.count(cellKey(coord))) {
+            return false;
+        }
+    }
+
+    // Кораблі не можуть торкатися: у прямокутнику навколо корабля не повинно
+    // бути жодного інтервалу - ні горизонтального, ні вертикального
+    int top = first.row - 1;
+    int bottom = last.row + 1;
+    int left = first.col - 1;
+    int right = last.col + 1;
+
+    for (int row = top; row <= bottom; row++) {
+        if (shipOnLine(rowIndex, row, left, right) >= 0) {
+            return false;
+        }
+    }
+    for (int col = left; col <= right; col++) {
+        if (shipOnLine(columnIndex, col, top, bottom) >= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SparseBoard::placeShip(const Ship& ship) {
+    if (!canPlaceShip(ship)) {
+        return false;
+    }
+
+    int index = static_cast<int>(ships.size());
+    if (ship.orientation == HORIZONTAL) {
+        rowIndex[ship.start.row][ship.start.col] = index;
+    } else {
+        columnIndex[ship.start.col][ship.start.row] = index;
+    }
+
+    ships.push_back(ship);
+    if (!ship.isSunk()) {
+        liveShips++;
+    }
+    return true;
+}
+
+bool SparseBoard::placeShip(ShipType type, Coordinate start, Orientation orientation) {
+    return placeShip(Ship(type, start, orientation));
+}
+
+bool SparseBoard::placeShipsRandomly(const std::vector<ShipType>& fleet, std::mt19937& gen,
+                                     int maxAttempts) {
+    clear();
+    ships.reserve(fleet.size());
+
+    std::uniform_int_distribution<> rowDist(0, rows - 1);
+    std::uniform_int_distribution<> colDist(0, cols - 1);
+    std::uniform_int_distribution<> orientDist(0, 1);
+
+    for (ShipType type : fleet) {
+        bool placed = false;
+        for (int attempt = 0; attempt < maxAttempts && !placed; attempt++) {
+            Coordinate start(rowDist(gen), colDist(gen));
+            Orientation orientation = static_cast<Orientation>(orientDist(gen));
+            placed = placeShip(type, start, orientation);
+        }
+
+        if (!placed) {
+            // Частковий флот на дошці не залишаємо
+            clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+ShotResult SparseBoard::shoot(const Coordinate& coord) {
+    if (!contains(coord)) {
+        return SHOT_INVALID;
+    }
+
+    // Перевіряємо чи вже стріляли тут
+    if (!shots.insert(cellKey(coord)).second) {
+        return SHOT_INVALID;
+    }
+
+    // Промах
+    int index = shipAt(coord);
+    if (index < 0) {
+        totalMisses++;
+        return SHOT_MISS;
+    }
+
+    // Влучання
+    totalHits++;
+
+    Ship& ship = ships[index];
+    ship.hits++;
+
+    if (!ship.isSunk()) {
+        return SHOT_HIT;
+    }
+
+    liveShips--;
+    if (liveShips == 0) {
+        return SHOT_WIN;
+    }
+    return SHOT_SUNK;
+}
+
+CellState SparseBoard::getCell(const Coordinate& coord) const {
+    if (!contains(coord)) {
+        return EMPTY;
+    }
+
+    bool hasShip = shipAt(coord) >= 0;
+
+    if (shots.count(cellKey(coord))) {
+        return hasShip ? HIT : MISS;
+    }
+    return hasShip ? SHIP : EMPTY;
+}
+
+bool SparseBoard::isAttacked(const Coordinate& coord) const {
+    return contains(coord) && shots.count(cellKey(coord)) != 0;
+}
+
+void SparseBoard::display(Coordinate topLeft, int height, int width, bool hideShips) const {
+    // Вікно обрізаємо по межах дошки
+    int firstRow = std::max(0, topLeft.row);
+    int firstCol = std::max(0, topLeft.col);
+    int lastRow = std::min(rows, topLeft.row + height);
+    int lastCol = std::min(cols, topLeft.col + width);
+    
+    // Номери колонок великі, тому виводимо лише останню цифру
+    std::cout << std::setw(7) << " ";
+    for (int col = firstCol; col < lastCol; col++) {
+        std::cout << " " << col % 10;
+    }
+    std::cout << "\n";
+
+    for (int row = firstRow; row < lastRow; row++) {
+        std::cout << std::setw(6) << row << " ";
+
+        for (int col = firstCol; col < lastCol; col++) {
+            CellState cell = getCell(Coordinate(row, col));
+
+            if (hideShips && cell == SHIP) {
+                std::cout << " ~";  // Ховаємо кораблі противника
+            } else {
+                switch (cell) {
+                    case EMPTY:
+                        std::cout << " ~";
+                        break;
+                    case SHIP:
+                        std::cout << Color::BLUE << " S" << Color::RESET;
+                        break;
+                    case MISS:
+                        std::cout << Color::GRAY << " o" << Color::RESET;
+                        break;
+                    case HIT:
+                        std::cout << Color::RED << " X" << Color::RESET;
+                        break;
+                }
+            }
+        }
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+}
\ No newline at end of file
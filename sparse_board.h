@@ -0,0 +1,105 @@
+#ifndef SPARSE_BOARD_H
+#define SPARSE_BOARD_H
+
+#include "common.h"
+#include <cstdint>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Дошка для дуже великих карт ("океан"), наприклад 10000x10000.
+// Кожен корабель - інтервал на своїй лінії: горизонтальні індексуються за
+// рядком, вертикальні - за колонкою (впорядковані за початком). Постріли -
+// хеш-множина. Пам'ять залежить від кількості кораблів і пострілів, а час
+// операції - від їх логарифма та довжини корабля, а не від площі поля.
+// Правила ті самі, що й у Board.
+class SparseBoard {
+private:
+    int rows;
+    int cols;
+
+    // Кораблі на дошці
+    std::vector<Ship> ships;
+
+    // Кораблі однієї лінії (рядка чи колонки): початок інтервалу -> індекс
+    // у ships. Кораблі не перетинаються, тож кінці впорядковані так само
+    typedef std::map<int, int> LineIndex;
+    typedef std::unordered_map<int, LineIndex> LineTable;
+
+    LineTable rowIndex;     // Горизонтальні кораблі за номером рядка
+    LineTable columnIndex;  // Вертикальні кораблі за номером колонки
+
+    // Клітинки, по яких уже стріляли
+    std::unordered_set<uint64_t> shots;
+
+    // Статистика, яка оновлюється при кожному пострілі
+    int liveShips;
+    int totalHits;
+    int totalMisses;
+
+    uint64_t cellKey(const Coordinate& coord) const {
+        return static_cast<uint64_t>(coord.row) * static_cast<uint64_t>(cols) + coord.col;
+    }
+
+    // Корабель з table на лінії line, що перетинає відрізок [from, to]; -1 - немає
+    int shipOnLine(const LineTable& table, int line, int from, int to) const;
+
+    // Індекс корабля в клітинці; -1 - немає
+    int shipAt(const Coordinate& coord) const;
+
+    // Перевірка чи можна розмістити корабель
+    bool canPlaceShip(const Ship& ship) const;
+
+public:
+    SparseBoard(int rowCount, int colCount);
+
+    // Очистити дошку
+    void clear();
+
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+
+    // Чи лежить координата на дошці
+    bool contains(const Coordinate& coord) const {
+        return coord.row >= 0 && coord.row < rows && coord.col >= 0 && coord.col < cols;
+    }
+
+    // Розмістити корабель
+    bool placeShip(const Ship& ship);
+    bool placeShip(ShipType type, Coordinate start, Orientation orientation);
+
+    // Випадкове розміщення флоту. На розрідженому полі майже кожна спроба
+    // вдала; false (і порожня дошка), якщо корабель не вдалося поставити
+    // за maxAttempts спроб
+    bool placeShipsRandomly(const std::vector<ShipType>& fleet, std::mt19937& gen,
+                            int maxAttempts = 1000);
+
+    // Постріл по координатам
+    ShotResult shoot(const Coordinate& coord);
+
+    // Отримати стан клітинки
+    CellState getCell(const Coordinate& coord) const;
+
+    // Перевірка чи координата вже атакована
+    bool isAttacked(const Coordinate& coord) const;
+
+    // Перевірка чи всі кораблі потоплені
+    bool allShipsSunk() const { return liveShips == 0; }
+
+    // Отримати кількість живих кораблів
+    int getRemainingShips() const { return liveShips; }
+
+    // Отримати всі кораблі
+    const std::vector<Ship>& getShips() const { return ships; }
+
+    // Отримати статистику
+    int getTotalHits() const { return totalHits; }
+    int getTotalMisses() const { return totalMisses; }
+
+    // Вивести в консоль вікно дошки з лівим верхнім кутом topLeft
+    void display(Coordinate topLeft, int height, int width, bool hideShips = false) const;
+};
+
+#endif // SPARSE_BOARD_H
\ No newline at end of file
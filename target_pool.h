@@ -0,0 +1,96 @@
+#ifndef TARGET_POOL_H
+#define TARGET_POOL_H
+
+#include "common.h"
+#include "board.h"
+#include <random>
+#include <vector>
+
+// Набір клітинок-кандидатів для AI (indexed sparse set).
+// Клітинки лежать у щільному масиві, а для кожної клітинки дошки
+// зберігається її позиція в ньому. Видалення переносить останню клітинку
+// на місце видаленої, тож додавання, видалення за координатою та
+// випадковий вибір працюють за O(1), а порядок елементів неважливий.
+class TargetPool {
+private:
+    std::vector<int> cells;
+    std::vector<int> position;  // Позиція клітинки в cells або -1
+
+public:
+    explicit TargetPool(int capacity = Board::CELLS)
+        : position(capacity, -1) {
+        cells.reserve(capacity);
+    }
+
+    // Усі клітинки дошки
+    void fill() {
+        cells.clear();
+        for (int cell = 0; cell < static_cast<int>(position.size()); cell++) {
+            position[cell] = cell;
+            cells.push_back(cell);
+        }
+    }
+
+    void clear() {
+        for (int cell : cells) {
+            position[cell] = -1;
+        }
+        cells.clear();
+    }
+
+    int size() const { return static_cast<int>(cells.size()); }
+    bool empty() const { return cells.empty(); }
+
+    bool contains(int cell) const {
+        return cell >= 0 && cell < static_cast<int>(position.size()) && position[cell] >= 0;
+    }
+
+    bool contains(const Coordinate& coord) const {
+        return Board::contains(coord) && contains(Board::cellIndex(coord));
+    }
+
+    // false, якщо клітинка вже в наборі
+    bool insert(int cell) {
+        if (contains(cell)) return false;
+
+        position[cell] = size();
+        cells.push_back(cell);
+        return true;
+    }
+
+    // false, якщо клітинки в наборі немає
+    bool remove(int cell) {
+        if (!contains(cell)) return false;
+
+        int last = cells.back();
+        cells[position[cell]] = last;
+        position[last] = position[cell];
+        position[cell] = -1;
+        cells.pop_back();
+        return true;
+    }
+
+    bool remove(const Coordinate& coord) {
+        return Board::contains(coord) && remove(Board::cellIndex(coord));
+    }
+
+    // Випадкова клітинка з набору (набір не порожній)
+    template <typename Generator>
+    int draw(Generator& gen) const {
+        std::uniform_int_distribution<int> dist(0, size() - 1);
+        return cells[dist(gen)];
+    }
+
+    // Випадкова клітинка, яку одразу прибирають з набору
+    template <typename Generator>
+    int take(Generator& gen) {
+        int cell = draw(gen);
+        remove(cell);
+        return cell;
+    }
+
+    // Клітинки в довільному порядку
+    const std::vector<int>& getCells() const { return cells; }
+};
+
+#endif // TARGET_POOL_H
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "common.h"
+#include "board.h"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+// Перевірка: розміщення кораблів і постріли по Board не виділяють пам'ять.
+// Глобальний operator new рахує виділення між beginCount() і endCount().
+//
+// Збірка:
+//   g++ -std=c++17 -O2 test_board_alloc.cpp board.cpp fleet_sampler.cpp -o test_board_alloc
+
+namespace {
+    bool counting = false;
+    long allocations = 0;
+    
+    void beginCount() {
+        allocations = 0;
+        counting = true;
+    }
+    
+    long endCount() {
+        counting = false;
+        return allocations;
+    }
+    
+    int failures = 0;
+    
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAIL: %s\n", what);
+            failures++;
+        }
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (counting) allocations++;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+int main() {
+    std::mt19937 gen(1);
+    Board board;
+    
+    // Перший виклик будує статичні таблиці - він поза підрахунком
+    board.placeShipsRandomly(gen);
+    
+    int unplaced = 0;
+    beginCount();
+    for (int i = 0; i < 1000; i++) {
+        unplaced += board.placeShipsRandomly(gen) ? 0 : 1;
+    }
+    check(endCount() == 0, "placeShipsRandomly allocates");
+    check(unplaced == 0, "placeShipsRandomly failed on the standard fleet");
+    
+    beginCount();
+    for (int i = 0; i < 1000; i++) {
+        board.clear();
+        board.placeShip(CARRIER, Coordinate(0, 0), HORIZONTAL);
+        board.placeShip(BATTLESHIP, Coordinate(2, 0), VERTICAL);
+        board.placeShip(DESTROYER, Coordinate(9, 8), HORIZONTAL);
+    }
+    check(endCount() == 0, "placeShip allocates");
+    
+    beginCount();
+    for (int i = 0; i < 100; i++) {
+        board.placeShipsRandomly(gen);
+        for (int index = 0; index < Board::CELLS; index++) {
+            board.shoot(Coordinate(index / Board::COLS, index % Board::COLS));
+        }
+    }
+    check(endCount() == 0, "shoot allocates");
+    check(board.allShipsSunk(), "not all ships sunk after shooting every cell");
+    
+    if (failures == 0) {
+        std::printf("test_board_alloc: OK\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include "density_kernel.h"
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+// Перевірка: DensityKernel на кожному доступному наборі інструкцій дає ту саму
+// густину, що й прямий перебір позицій, на 20000 випадкових дошках різного розміру.
+//
+// Збірка:
+//   g++ -std=c++17 -O2 test_density_kernel.cpp density_kernel.cpp -o test_density_kernel
+
+namespace {
+    const int BOARDS = 20000;
+    const int MAX_SHIP_SIZE = 5;
+    
+    int failures = 0;
+    
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAIL: %s\n", what);
+            failures++;
+        }
+    }
+    
+    bool isFree(const uint16_t* freeRows, int row, int col) {
+        return (freeRows[row] >> col) & 1;
+    }
+    
+    // Прямий перебір: корабель довжини 1 має одну позицію на клітинку,
+    // довший - горизонтальну та вертикальну
+    void countNaive(const uint16_t* freeRows, int rows, int cols,
+                    const int* shipCounts, int* density) {
+        for (int i = 0; i < rows * cols; i++) {
+            density[i] = 0;
+        }
+        
+        for (int k = 1; k <= MAX_SHIP_SIZE; k++) {
+            for (int row = 0; row < rows; row++) {
+                for (int col = 0; col < cols; col++) {
+                    bool horizontal = col + k <= cols;
+                    bool vertical = k > 1 && row + k <= rows;
+                    for (int i = 0; i < k; i++) {
+                        horizontal = horizontal && isFree(freeRows, row, col + i);
+                        vertical = vertical && isFree(freeRows, row + i, col);
+                    }
+                    for (int i = 0; i < k; i++) {
+                        if (horizontal) density[row * cols + col + i] += shipCounts[k];
+                        if (vertical) density[(row + i) * cols + col] += shipCounts[k];
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    const DensityKernel::Isa best = DensityKernel::detectIsa();
+    std::mt19937 gen(1);
+    
+    int checked = 0;
+    for (int board = 0; board < BOARDS; board++) {
+        int rows = std::uniform_int_distribution<>(1, DensityKernel::MAX_ROWS)(gen);
+        int cols = std::uniform_int_distribution<>(1, DensityKernel::MAX_COLS)(gen);
+        
+        // Частка зайнятих клітинок різна, щоб траплялись і порожні, і щільні дошки
+        std::uniform_int_distribution<> percent(0, 99);
+        int blockedPercent = percent(gen);
+        uint16_t freeRows[DensityKernel::MAX_ROWS];
+        for (int row = 0; row < rows; row++) {
+            freeRows[row] = 0;
+            for (int col = 0; col < cols; col++) {
+                if (percent(gen) >= blockedPercent) {
+                    freeRows[row] |= static_cast<uint16_t>(1u << col);
+                }
+            }
+        }
+        
+        // Кількості кораблів у межах лічильника ядра
+        int shipCounts[MAX_SHIP_SIZE + 1] = {};
+        int total = 0;
+        for (int k = 1; k <= MAX_SHIP_SIZE; k++) {
+            int count = std::uniform_int_distribution<>(0, 12)(gen);
+            if (total + count * 2 * k > DensityKernel::MAX_COUNT) break;
+            shipCounts[k] = count;
+            total += count * 2 * k;
+        }
+        
+        int expected[DensityKernel::MAX_ROWS * DensityKernel::MAX_COLS];
+        countNaive(freeRows, rows, cols, shipCounts, expected);
+        
+        for (int isa = DensityKernel::ISA_SCALAR; isa <= best; isa++) {
+            int density[DensityKernel::MAX_ROWS * DensityKernel::MAX_COLS];
+            bool counted = DensityKernel::countPlacements(static_cast<DensityKernel::Isa>(isa),
+                                                          freeRows, rows, cols,
+                                                          shipCounts, MAX_SHIP_SIZE, density);
+            check(counted, "countPlacements rejected a supported board");
+            
+            bool same = true;
+            for (int i = 0; counted && i < rows * cols; i++) {
+                same = same && density[i] == expected[i];
+            }
+            if (!same) {
+                std::printf("board %d (%dx%d), isa %s:\n", board, rows, cols,
+                            DensityKernel::isaName(static_cast<DensityKernel::Isa>(isa)));
+            }
+            check(same, "density differs from the naive count");
+            checked++;
+        }
+    }
+    
+    // Лічильник, який може переповнитись, ядро відхиляє
+    uint16_t freeRows[1] = {0xFFFF};
+    int shipCounts[2] = {0, DensityKernel::MAX_COUNT};
+    int density[DensityKernel::MAX_COLS];
+    check(!DensityKernel::countPlacements(freeRows, 1, 16, shipCounts, 1, density),
+          "overflowing counts accepted");
+    
+    if (failures == 0) {
+        std::printf("test_density_kernel: OK (%d перевірок, до %s)\n", checked, DensityKernel::isaName(best));
+        return 0;
+    }
+    return 1;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "common.h"
+#include "board.h"
+#include "density_map.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Перевірка: DensityMap, оновлена після кожного пострілу (update), після
+// кожного пострілу 3000 випадкових партій збігається з картою, побудованою
+// з нуля (rebuild) за тим самим станом tracking board, для кожного розміру корабля.
+//
+// Збірка:
+//   g++ -std=c++17 -O2 test_density_map.cpp density_map.cpp board.cpp fleet_sampler.cpp -o test_density_map
+
+namespace {
+    const int GAMES = 3000;
+    
+    int failures = 0;
+    
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAIL: %s\n", what);
+            failures++;
+        }
+    }
+    
+    // Карти однакові, якщо збігається густина кожного розміру окремо
+    bool sameDensity(const DensityMap& incremental, const DensityMap& rebuilt) {
+        for (int size = 1; size <= StandardGeometry::MAX_SHIP_SIZE; size++) {
+            DensityMap::ShipCounts counts = {};
+            counts[size] = 1;
+            
+            DensityMap::Density expected;
+            DensityMap::Density actual;
+            rebuilt.combine(counts, expected);
+            incremental.combine(counts, actual);
+            if (actual != expected) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    std::mt19937 gen(1);
+    
+    std::vector<Coordinate> cells;
+    for (int index = 0; index < Board::CELLS; index++) {
+        cells.push_back(Coordinate(index / Board::COLS, index % Board::COLS));
+    }
+    
+    long long shots = 0;
+    int mismatchedGames = 0;
+    for (int game = 0; game < GAMES; game++) {
+        Board target;
+        check(target.placeShipsRandomly(gen), "fleet placement failed");
+        
+        Board tracking;
+        DensityMap incremental;
+        DensityMap rebuilt;
+        incremental.reset();
+        
+        std::shuffle(cells.begin(), cells.end(), gen);
+        
+        bool same = true;
+        for (const Coordinate& cell : cells) {
+            ShotResult result = target.shoot(cell);
+            tracking.recordShot(cell, result);
+            incremental.update(tracking, cell, result);
+            shots++;
+            
+            rebuilt.rebuild(tracking);
+            same = same && incremental.isSyncedWith(tracking) && sameDensity(incremental, rebuilt);
+            
+            if (result == SHOT_WIN) {
+                break;
+            }
+        }
+        
+        if (!same) {
+            mismatchedGames++;
+        }
+    }
+    check(mismatchedGames == 0, "incremental density differs from rebuild");
+    
+    if (failures == 0) {
+        std::printf("test_density_map: OK (%d партій, %lld пострілів)\n", GAMES, shots);
+        return 0;
+    }
+    std::printf("розбіжності у %d партіях з %d\n", mismatchedGames, GAMES);
+    return 1;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "common.h"
+#include "board.h"
+#include "ai.h"
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Перевірка: режим пошуку SmartAI за замовчуванням вибирає ціль через
+// Board::Mask::select - лише серед ще не обстріляних клітинок парності 0,
+// рівномірно (критерій хі-квадрат), а після них - серед клітинок парності 1.
+//
+// Збірка:
+//   g++ -std=c++17 -O2 -pthread test_smart_hunt.cpp ai_random.cpp ai_smart.cpp player.cpp board.cpp fleet_sampler.cpp endgame_solver.cpp opening_book.cpp placement_library.cpp opponent_model.cpp density_map.cpp density_kernel.cpp thread_pool.cpp -o test_smart_hunt
+
+namespace {
+    const int TRIALS = 50000;
+    
+    // Критичні значення хі-квадрат для p = 0.001
+    const double CHI_SQUARE_49 = 85.35;
+    const double CHI_SQUARE_39 = 72.05;
+    
+    int failures = 0;
+    
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAIL: %s\n", what);
+            failures++;
+        }
+    }
+    
+    int parityOf(const Coordinate& coord) {
+        return (coord.row + coord.col) % 2;
+    }
+    
+    // Перший хід пошуку після пострілів misses. Розв'язувач кінця гри вимкнено,
+    // щоб хід робив лише режим пошуку
+    Coordinate huntTarget(SmartAI& ai, unsigned seed, const std::vector<Coordinate>& misses) {
+        ai.reset();
+        ai.setSeed(seed);
+        for (const Coordinate& miss : misses) {
+            ai.processShotResult(miss, SHOT_MISS);
+        }
+        return ai.chooseTarget(MoveClock::now(), Pace::HEADLESS);
+    }
+    
+    // Статистика хі-квадрат для рівномірного розподілу по candidates
+    double chiSquare(const std::vector<int>& hits, const std::vector<Coordinate>& candidates, int trials) {
+        double expected = static_cast<double>(trials) / candidates.size();
+        double sum = 0;
+        for (const Coordinate& cell : candidates) {
+            double diff = hits[Board::cellIndex(cell)] - expected;
+            sum += diff * diff / expected;
+        }
+        return sum;
+    }
+}
+
+int main() {
+    SmartAI ai;
+    ai.setEndgameThreshold(0);
+    ai.setPace(Pace::HEADLESS);
+    check(!ai.getDensityHunt(), "density hunt is on by default");
+    
+    std::vector<Coordinate> parity[2];
+    for (int index = 0; index < Board::CELLS; index++) {
+        Coordinate cell(index / Board::COLS, index % Board::COLS);
+        parity[parityOf(cell)].push_back(cell);
+    }
+    
+    // Порожня дошка: усі 50 клітинок парності 0 рівноймовірні
+    std::vector<int> hits(Board::CELLS, 0);
+    for (int trial = 0; trial < TRIALS; trial++) {
+        Coordinate target = huntTarget(ai, trial, {});
+        check(Board::contains(target) && parityOf(target) == 0, "first hunt target has parity 1");
+        hits[Board::cellIndex(target)]++;
+    }
+    double empty = chiSquare(hits, parity[0], TRIALS);
+    check(empty < CHI_SQUARE_49, "first hunt target is not uniform");
+    
+    // Після 10 промахів лишаються 40 рівноймовірних кандидатів
+    std::vector<Coordinate> misses(parity[0].begin(), parity[0].begin() + 10);
+    std::vector<Coordinate> rest(parity[0].begin() + 10, parity[0].end());
+    hits.assign(Board::CELLS, 0);
+    for (int trial = 0; trial < TRIALS; trial++) {
+        Coordinate target = huntTarget(ai, trial, misses);
+        check(Board::contains(target) && parityOf(target) == 0, "hunt target has parity 1");
+        hits[Board::cellIndex(target)]++;
+    }
+    for (const Coordinate& miss : misses) {
+        check(hits[Board::cellIndex(miss)] == 0, "hunt target was already shot");
+    }
+    double partial = chiSquare(hits, rest, TRIALS);
+    check(partial < CHI_SQUARE_39, "hunt target after misses is not uniform");
+    
+    // Клітинки парності 0 закінчились - пошук переходить на парність 1
+    hits.assign(Board::CELLS, 0);
+    for (int trial = 0; trial < TRIALS; trial++) {
+        Coordinate target = huntTarget(ai, trial, parity[0]);
+        check(Board::contains(target) && parityOf(target) == 1, "fallback target has parity 0");
+        hits[Board::cellIndex(target)]++;
+    }
+    double fallback = chiSquare(hits, parity[1], TRIALS);
+    check(fallback < CHI_SQUARE_49, "fallback hunt target is not uniform");
+    
+    if (failures == 0) {
+        std::printf("test_smart_hunt: OK (хі-квадрат %.1f, %.1f, %.1f)\n", empty, partial, fallback);
+        return 0;
+    }
+    return 1;
+}
\ No newline at end of file
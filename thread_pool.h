@@ -0,0 +1,53 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// Фіксований пул потоків для паралельних обчислень AI.
+// Завдання виконуються в порядку надходження; wait() чекає, поки всі
+// надіслані завдання завершаться, run() - лише свої, тож одним пулом
+// можуть користуватися кілька AI одночасно.
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+
+    std::mutex mutex;
+    std::condition_variable taskReady;
+    std::condition_variable allDone;
+
+    int pending;    // Завдання в черзі та ті, що виконуються
+    bool stopping;
+
+    void workerLoop();
+
+public:
+    // threads = 0 - за кількістю ядер процесора
+    explicit ThreadPool(int threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return static_cast<int>(workers.size()); }
+
+    // Додати завдання до черги
+    void submit(std::function<void()> task);
+
+    // Дочекатися завершення всіх завдань
+    void wait();
+    
+    // Виконати task(0) .. task(count - 1) у пулі й дочекатися саме цих завдань
+    void run(int count, const std::function<void(int)>& task);
+    
+    // Спільний пул процесу за кількістю ядер; створюється при першому зверненні
+    static std::shared_ptr<ThreadPool> shared();
+};
+
+#endif // THREAD_POOL_H
\ No newline at end of file
@@ -181,6 +181,31 @@ void displayTurnInfo(const std::string& playerName, int turnNumber) {
     std::cout << "╚════════════════════════════════════════════════════════════╝\n\n";
 }
 
+// Результат пострілу
+void displayShotResult(ShotResult result) {
+    switch (result) {
+        case SHOT_MISS:
+            std::cout << Color::GRAY << "Промах!\n" << Color::RESET;
+            break;
+            
+        case SHOT_HIT:
+            std::cout << Color::YELLOW << "Влучання!\n" << Color::RESET;
+            break;
+            
+        case SHOT_SUNK:
+            std::cout << Color::RED << "Корабель потоплено!\n" << Color::RESET;
+            break;
+            
+        case SHOT_WIN:
+            std::cout << Color::GREEN << "Всі кораблі противника знищено! Перемога!\n" << Color::RESET;
+            break;
+            
+        case SHOT_INVALID:
+            std::cout << Color::RED << "Ви вже стріляли сюди! Спробуйте інші координати.\n" << Color::RESET;
+            break;
+    }
+}
+
 // Екран зміни гравця (для локальної гри)
 void showPlayerSwitchScreen(const std::string& nextPlayer) {
     clearScreen();
@@ -0,0 +1,45 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <array>
+#include <cstdint>
+
+// Випадкові ключі Zobrist для хешування стану дошки.
+// Хеш позиції - XOR ключів усіх зайнятих станів клітинок, тому при зміні
+// однієї клітинки він оновлюється одним XOR. Ключі генеруються під час
+// компіляції з фіксованого зерна, тож хеші однакові між запусками.
+namespace Zobrist {
+    // Генератор SplitMix64
+    constexpr uint64_t splitMix64(uint64_t& state) {
+        state += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    template <int Cells>
+    struct Keys {
+        std::array<uint64_t, Cells> ship;  // У клітинці корабель
+        std::array<uint64_t, Cells> miss;  // Промах
+        std::array<uint64_t, Cells> hit;   // Влучання
+        std::array<uint64_t, Cells> sunk;  // Клітинка потопленого корабля
+    };
+
+    template <int Cells>
+    constexpr Keys<Cells> build() {
+        Keys<Cells> keys{};
+        uint64_t state = 0x5EAB477150B21570ULL;
+
+        for (int i = 0; i < Cells; i++) keys.ship[i] = splitMix64(state);
+        for (int i = 0; i < Cells; i++) keys.miss[i] = splitMix64(state);
+        for (int i = 0; i < Cells; i++) keys.hit[i] = splitMix64(state);
+        for (int i = 0; i < Cells; i++) keys.sunk[i] = splitMix64(state);
+        return keys;
+    }
+
+    template <int Cells>
+    inline constexpr Keys<Cells> KEYS = build<Cells>();
+}
+
+#endif // ZOBRIST_H
\ No newline at end of file